@@ -0,0 +1,81 @@
+//
+//  Benchmarks.hpp
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <Function/Function.h>
+
+namespace Function::Benchmarks {
+
+    /*!
+     @function GetEnvironment
+
+     @abstract Get an environment variable, or a fallback if it is not set.
+    */
+    inline const char* GetEnvironment (const char* name, const char* fallback) {
+        const char* value = std::getenv(name);
+        return value && *value ? value : fallback;
+    }
+
+    /*!
+     @function CreateConfiguration
+
+     @abstract Create a configuration for a predictor tag.
+
+     @discussion The access token is read from the `FXN_ACCESS_KEY` environment variable.
+    */
+    inline FXNConfiguration* CreateConfiguration (const char* tag) {
+        FXNConfiguration* configuration = nullptr;
+        FXNConfigurationCreate(&configuration);
+        FXNConfigurationSetTag(configuration, tag);
+        if (const char* token = std::getenv("FXN_ACCESS_KEY"))
+            FXNConfigurationSetToken(configuration, token);
+        return configuration;
+    }
+
+    /*!
+     @function CheckPrediction
+
+     @abstract Check that a prediction was created without an error.
+
+     @discussion The benchmark is skipped with an error if the prediction failed,
+     so that error paths are not measured.
+    */
+    inline bool CheckPrediction (benchmark::State& state, FXNStatus status, FXNPrediction* prediction) {
+        char error[256];
+        if (status != FXN_OK)
+            state.SkipWithError("Failed to create prediction");
+        else if (FXNPredictionGetError(prediction, error, sizeof(error)) == FXN_OK)
+            state.SkipWithError("Prediction failed");
+        else
+            return true;
+        return false;
+    }
+
+    /*!
+     @function ReportPercentiles
+
+     @abstract Report latency percentiles in microseconds as benchmark counters.
+    */
+    inline void ReportPercentiles (benchmark::State& state, std::vector<double>& latencies) {
+        if (latencies.empty())
+            return;
+        std::sort(latencies.begin(), latencies.end());
+        const auto percentile = [&] (double p) {
+            return latencies[static_cast<size_t>(p * static_cast<double>(latencies.size() - 1))];
+        };
+        state.counters["p50_us"] = percentile(0.50);
+        state.counters["p90_us"] = percentile(0.90);
+        state.counters["p99_us"] = percentile(0.99);
+        state.counters["max_us"] = latencies.back();
+    }
+}
@@ -0,0 +1,55 @@
+//
+//  PredictionStreamBenchmarks.cpp
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#include "Benchmarks.hpp"
+
+using namespace Function::Benchmarks;
+
+static void BM_PredictionStreamReadNext (benchmark::State& state) {
+    const char* tag = GetEnvironment("FXN_BENCHMARK_STREAM_TAG", "@mock/tokens?count=256");
+    FXNConfiguration* configuration = CreateConfiguration(tag);
+    FXNPredictor* predictor = nullptr;
+    const auto status = FXNPredictorCreate(configuration, &predictor);
+    FXNConfigurationRelease(configuration);
+    if (status != FXN_OK) {
+        state.SkipWithError("Failed to create predictor");
+        return;
+    }
+    FXNValueMap* inputs = nullptr;
+    FXNValueMapCreate(&inputs);
+    int64_t items = 0;
+    for (auto _ : state) {
+        FXNPredictionStream* stream = nullptr;
+        if (FXNPredictorStreamPrediction(predictor, inputs, &stream) != FXN_OK) {
+            state.SkipWithError("Failed to create prediction stream");
+            break;
+        }
+        // The stream reports `FXN_ERROR_INVALID_OPERATION` once every prediction has been read
+        FXNPrediction* prediction = nullptr;
+        FXNStatus status = FXN_OK;
+        while ((status = FXNPredictionStreamReadNext(stream, &prediction)) == FXN_OK) {
+            const auto valid = CheckPrediction(state, status, prediction);
+            FXNPredictionRelease(prediction);
+            if (!valid)
+                break;
+            ++items;
+        }
+        FXNPredictionStreamRelease(stream);
+        if (status == FXN_OK)
+            break;
+        if (status != FXN_ERROR_INVALID_OPERATION) {
+            state.SkipWithError("Failed to read prediction stream");
+            break;
+        }
+    }
+    // Per-item overhead is the reciprocal of the items-per-second rate
+    state.SetItemsProcessed(items);
+    FXNValueMapRelease(inputs);
+    FXNPredictorRelease(predictor);
+}
+BENCHMARK(BM_PredictionStreamReadNext)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,100 @@
+//
+//  PredictorBenchmarks.cpp
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#include <chrono>
+#include <vector>
+#include "Benchmarks.hpp"
+
+using namespace Function::Benchmarks;
+
+static const char* GetPredictorTag () {
+    return GetEnvironment("FXN_BENCHMARK_TAG", "@mock/echo");
+}
+
+static void BM_PredictorCreate (benchmark::State& state) {
+    FXNConfiguration* configuration = CreateConfiguration(GetPredictorTag());
+    for (auto _ : state) {
+        FXNPredictor* predictor = nullptr;
+        if (FXNPredictorCreate(configuration, &predictor) != FXN_OK) {
+            state.SkipWithError("Failed to create predictor");
+            break;
+        }
+        FXNPredictorRelease(predictor);
+    }
+    FXNConfigurationRelease(configuration);
+}
+// The first creation in the process includes one-time runtime initialization
+BENCHMARK(BM_PredictorCreate)->Name("BM_PredictorCreate/FirstInProcess")->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_PredictorCreate)->Name("BM_PredictorCreate/Repeated")->Unit(benchmark::kMillisecond);
+
+static void BM_PredictorCreatePrediction (benchmark::State& state) {
+    FXNConfiguration* configuration = CreateConfiguration(GetPredictorTag());
+    FXNPredictor* predictor = nullptr;
+    const auto status = FXNPredictorCreate(configuration, &predictor);
+    FXNConfigurationRelease(configuration);
+    if (status != FXN_OK) {
+        state.SkipWithError("Failed to create predictor");
+        return;
+    }
+    FXNValueMap* inputs = nullptr;
+    FXNValueMapCreate(&inputs);
+    std::vector<double> latencies;
+    for (auto _ : state) {
+        const auto start = std::chrono::steady_clock::now();
+        FXNPrediction* prediction = nullptr;
+        const auto status = FXNPredictorCreatePrediction(predictor, inputs, &prediction);
+        const auto end = std::chrono::steady_clock::now();
+        const auto valid = CheckPrediction(state, status, prediction);
+        FXNPredictionRelease(prediction);
+        if (!valid)
+            break;
+        latencies.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+    }
+    ReportPercentiles(state, latencies);
+    FXNValueMapRelease(inputs);
+    FXNPredictorRelease(predictor);
+}
+BENCHMARK(BM_PredictorCreatePrediction)->Unit(benchmark::kMicrosecond);
+
+#ifdef FXN_MOCK
+static void BM_BoundPredictionRun (benchmark::State& state) {
+    FXNConfiguration* configuration = CreateConfiguration(GetPredictorTag());
+    FXNPredictor* predictor = nullptr;
+    const auto status = FXNPredictorCreate(configuration, &predictor);
+    FXNConfigurationRelease(configuration);
+    if (status != FXN_OK) {
+        state.SkipWithError("Failed to create predictor");
+        return;
+    }
+    FXNValueMap* inputs = nullptr;
+    FXNValueMapCreate(&inputs);
+    FXNBoundPrediction* prediction = nullptr;
+    if (FXNBoundPredictionCreate(predictor, inputs, &prediction) != FXN_OK) {
+        state.SkipWithError("Failed to create bound prediction");
+        FXNValueMapRelease(inputs);
+        FXNPredictorRelease(predictor);
+        return;
+    }
+    std::vector<double> latencies;
+    for (auto _ : state) {
+        const auto start = std::chrono::steady_clock::now();
+        const auto status = FXNBoundPredictionRun(prediction);
+        const auto end = std::chrono::steady_clock::now();
+        if (status != FXN_OK) {
+            state.SkipWithError("Failed to run bound prediction");
+            break;
+        }
+        latencies.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+    }
+    ReportPercentiles(state, latencies);
+    FXNBoundPredictionRelease(prediction);
+    FXNValueMapRelease(inputs);
+    FXNPredictorRelease(predictor);
+}
+BENCHMARK(BM_BoundPredictionRun)->Unit(benchmark::kMicrosecond);
+#endif
@@ -0,0 +1,93 @@
+//
+//  ReplayBenchmarks.cpp
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "Benchmarks.hpp"
+
+#ifdef FXN_MOCK
+using namespace Function::Benchmarks;
+
+// Replays a recording created with `FXNConfigurationSetRecordingPath`.
+// Predictions are issued at their recorded times from `FXN_BENCHMARK_REPLAY_THREADS` threads,
+// and latency is measured from the time each prediction was scheduled rather than issued,
+// so that predictions delayed behind slow ones are charged for the delay.
+// A replay rate of 1 preserves the recorded pacing, greater rates accelerate it,
+// and zero issues predictions as fast as the threads allow, measuring latency from when each is issued.
+// The benchmark is only registered when `FXN_BENCHMARK_RECORDING` is set.
+static void BM_PredictorReplay (benchmark::State& state) {
+    using Clock = std::chrono::steady_clock;
+    const char* path = GetEnvironment("FXN_BENCHMARK_RECORDING", nullptr);
+    const double rate = std::atof(GetEnvironment("FXN_BENCHMARK_REPLAY_RATE", "1"));
+    const int32_t threads = std::atoi(GetEnvironment("FXN_BENCHMARK_REPLAY_THREADS", "0"));
+    FXNRecording* recording = nullptr;
+    if (FXNRecordingCreate(path, &recording) != FXN_OK) {
+        state.SkipWithError("Failed to open recording in FXN_BENCHMARK_RECORDING");
+        return;
+    }
+    FXNConfiguration* configuration = CreateConfiguration(GetEnvironment("FXN_BENCHMARK_TAG", "@mock/echo"));
+    FXNPredictor* predictor = nullptr;
+    const auto status = FXNPredictorCreate(configuration, &predictor);
+    FXNConfigurationRelease(configuration);
+    if (status != FXN_OK) {
+        state.SkipWithError("Failed to create predictor");
+        FXNRecordingRelease(recording);
+        return;
+    }
+    int32_t count = 0;
+    FXNRecordingGetCount(recording, &count);
+    const auto workerCount = threads > 0 ? threads : static_cast<int32_t>(std::max(1u, std::thread::hardware_concurrency()));
+    std::vector<double> latencies(static_cast<size_t>(count));
+    std::atomic<bool> failed { false };
+    for (auto _ : state) {
+        std::atomic<int32_t> next { 0 };
+        const auto origin = Clock::now();
+        const auto replay = [&] {
+            for (int32_t i = next++; i < count && !failed; i = next++) {
+                FXNValueMap* inputs = nullptr;
+                double timestamp = 0;
+                FXNRecordingGetPrediction(recording, i, &inputs, &timestamp, nullptr);
+                const auto offset = std::chrono::duration<double, std::milli>(rate > 0 ? timestamp / rate : 0);
+                auto scheduled = origin + std::chrono::duration_cast<Clock::duration>(offset);
+                // Sleeping overshoots by the scheduler wakeup latency, so the last stretch is spun
+                std::this_thread::sleep_until(scheduled - std::chrono::microseconds(200));
+                while (Clock::now() < scheduled)
+                    std::this_thread::yield();
+                if (rate <= 0)
+                    scheduled = Clock::now();
+                FXNPrediction* prediction = nullptr;
+                char error[256];
+                const auto status = FXNPredictorCreatePrediction(predictor, inputs, &prediction);
+                const auto end = Clock::now();
+                if (status != FXN_OK || FXNPredictionGetError(prediction, error, sizeof(error)) == FXN_OK)
+                    failed = true;
+                FXNPredictionRelease(prediction);
+                latencies[static_cast<size_t>(i)] = std::chrono::duration<double, std::micro>(end - scheduled).count();
+            }
+        };
+        std::vector<std::thread> workers;
+        for (int32_t i = 0; i < workerCount; ++i)
+            workers.emplace_back(replay);
+        for (auto& worker : workers)
+            worker.join();
+        if (failed) {
+            state.SkipWithError("Failed to create prediction");
+            latencies.clear();
+            break;
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(latencies.size()));
+    ReportPercentiles(state, latencies);
+    FXNPredictorRelease(predictor);
+    FXNRecordingRelease(recording);
+}
+static const auto BM_PredictorReplayRegistered = GetEnvironment("FXN_BENCHMARK_RECORDING", nullptr) &&
+    benchmark::RegisterBenchmark("BM_PredictorReplay", BM_PredictorReplay)->Iterations(1)->Unit(benchmark::kMillisecond)->UseRealTime();
+#endif
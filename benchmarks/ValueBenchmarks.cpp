@@ -0,0 +1,54 @@
+//
+//  ValueBenchmarks.cpp
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#include <vector>
+#include "Benchmarks.hpp"
+
+static void BM_ValueCreateArray (benchmark::State& state, FXNValueFlags flags) {
+    const auto count = static_cast<int32_t>(state.range(0));
+    std::vector<float> data(static_cast<size_t>(count));
+    for (auto _ : state) {
+        FXNValue* value = nullptr;
+        FXNValueCreateArray(data.data(), &count, 1, FXN_DTYPE_FLOAT32, flags, &value);
+        benchmark::DoNotOptimize(value);
+        FXNValueRelease(value);
+    }
+    state.SetBytesProcessed(state.iterations() * count * static_cast<int64_t>(sizeof(float)));
+}
+BENCHMARK_CAPTURE(BM_ValueCreateArray, NoCopy, FXN_VALUE_FLAG_NONE)->RangeMultiplier(16)->Range(1, 1 << 24);
+BENCHMARK_CAPTURE(BM_ValueCreateArray, CopyData, FXN_VALUE_FLAG_COPY_DATA)->RangeMultiplier(16)->Range(1, 1 << 24);
+
+static void BM_ValueGetData (benchmark::State& state) {
+    float data[16] = { };
+    const int32_t shape[] = { 4, 4 };
+    FXNValue* value = nullptr;
+    FXNValueCreateArray(data, shape, 2, FXN_DTYPE_FLOAT32, FXN_VALUE_FLAG_NONE, &value);
+    for (auto _ : state) {
+        void* result = nullptr;
+        FXNValueGetData(value, &result);
+        benchmark::DoNotOptimize(result);
+    }
+    FXNValueRelease(value);
+}
+BENCHMARK(BM_ValueGetData);
+
+static void BM_ValueGetShape (benchmark::State& state) {
+    float data[16] = { };
+    const int32_t shape[] = { 1, 2, 2, 4 };
+    FXNValue* value = nullptr;
+    FXNValueCreateArray(data, shape, 4, FXN_DTYPE_FLOAT32, FXN_VALUE_FLAG_NONE, &value);
+    for (auto _ : state) {
+        int32_t dims = 0;
+        int32_t result[4];
+        FXNValueGetDimensions(value, &dims);
+        FXNValueGetShape(value, result, dims);
+        benchmark::DoNotOptimize(result);
+    }
+    FXNValueRelease(value);
+}
+BENCHMARK(BM_ValueGetShape);
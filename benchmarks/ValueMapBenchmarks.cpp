@@ -0,0 +1,54 @@
+//
+//  ValueMapBenchmarks.cpp
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#include <string>
+#include <vector>
+#include "Benchmarks.hpp"
+
+static std::vector<std::string> CreateKeys (int64_t count) {
+    std::vector<std::string> keys;
+    for (int64_t i = 0; i < count; ++i)
+        keys.push_back("input_" + std::to_string(i));
+    return keys;
+}
+
+static void BM_ValueMapSetValue (benchmark::State& state) {
+    const auto keys = CreateKeys(state.range(0));
+    for (auto _ : state) {
+        FXNValueMap* map = nullptr;
+        FXNValueMapCreate(&map);
+        for (const auto& key : keys) {
+            FXNValue* value = nullptr;
+            FXNValueCreateNull(&value);
+            FXNValueMapSetValue(map, key.c_str(), value);
+        }
+        FXNValueMapRelease(map);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ValueMapSetValue)->RangeMultiplier(4)->Range(1, 256);
+
+static void BM_ValueMapGetValue (benchmark::State& state) {
+    const auto keys = CreateKeys(state.range(0));
+    FXNValueMap* map = nullptr;
+    FXNValueMapCreate(&map);
+    for (const auto& key : keys) {
+        FXNValue* value = nullptr;
+        FXNValueCreateNull(&value);
+        FXNValueMapSetValue(map, key.c_str(), value);
+    }
+    for (auto _ : state)
+        for (const auto& key : keys) {
+            FXNValue* value = nullptr;
+            FXNValueMapGetValue(map, key.c_str(), &value);
+            benchmark::DoNotOptimize(value);
+        }
+    FXNValueMapRelease(map);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ValueMapGetValue)->RangeMultiplier(4)->Range(1, 256);
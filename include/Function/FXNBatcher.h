@@ -0,0 +1,105 @@
+//
+//  FXNBatcher.h
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#pragma once
+
+#include <Function/FXNPredictor.h>
+
+#ifdef FXN_MOCK
+#pragma region --Types--
+/*!
+ @struct FXNBatcher
+
+ @abstract Dynamic micro-batching scheduler for a predictor.
+
+ @discussion Dynamic micro-batching scheduler for a predictor.
+ The batcher coalesces concurrent prediction requests into a single batched prediction.
+ Requests are collected until the batch is full, or until the oldest request has waited for the maximum delay.
+ For predictors whose inputs have a leading batch dimension, inputs are concatenated along that dimension,
+ the predictor is run once, and results are split back into one prediction per request.
+ Other requests are executed one after another.
+ Batched predictions do not use the predictor result cache.
+*/
+struct FXNBatcher;
+typedef struct FXNBatcher FXNBatcher;
+#pragma endregion
+
+
+#pragma region --Lifecycle--
+/*!
+ @function FXNBatcherCreate
+
+ @abstract Create a batcher.
+
+ @discussion Create a batcher.
+
+ @param predictor
+ Predictor. MUST remain valid for the lifetime of the batcher.
+
+ @param maxBatchSize
+ Maximum number of requests in a batch. MUST be positive.
+
+ @param maxDelay
+ Maximum time in microseconds that a request waits for other requests to join its batch.
+
+ @param batcher
+ Created batcher.
+
+ @returns `FXN_OK` if the batcher was created.
+*/
+FXN_API FXNStatus FXNBatcherCreate (
+    FXNPredictor* predictor,
+    int32_t maxBatchSize,
+    int32_t maxDelay,
+    FXNBatcher** batcher
+);
+
+/*!
+ @function FXNBatcherRelease
+
+ @abstract Release a batcher.
+
+ @discussion Release a batcher.
+ Pending requests are executed, and their callers have returned, before this function returns.
+ Requests made after this function is called fail with `FXN_ERROR_INVALID_OPERATION`.
+
+ @param batcher
+ Batcher.
+*/
+FXN_API FXNStatus FXNBatcherRelease (FXNBatcher* batcher);
+#pragma endregion
+
+
+#pragma region --Operations--
+/*!
+ @function FXNBatcherCreatePrediction
+
+ @abstract Create a prediction as part of a batch.
+
+ @discussion Create a prediction as part of a batch.
+ This function is thread-safe and blocks until the batch containing the request has been executed.
+ Requests whose inputs do not match the predictor signature are executed individually.
+ The prediction latency includes the time that the request waited for its batch.
+
+ @param batcher
+ Batcher.
+
+ @param inputs
+ Prediction inputs.
+
+ @param prediction
+ Prediction.
+ You MUST release the prediction with `FXNPredictionRelease` when no longer needed.
+*/
+FXN_API FXNStatus FXNBatcherCreatePrediction (
+    FXNBatcher* batcher,
+    FXNValueMap* inputs,
+    FXNPrediction** prediction
+);
+#pragma endregion
+#endif
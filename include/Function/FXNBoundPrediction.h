@@ -0,0 +1,133 @@
+//
+//  FXNBoundPrediction.h
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#pragma once
+
+#include <Function/FXNPredictor.h>
+
+#ifdef FXN_MOCK
+#pragma region --Types--
+/*!
+ @struct FXNBoundPrediction
+
+ @abstract Prediction bound to fixed input shapes.
+
+ @discussion Prediction bound to fixed input shapes.
+ A bound prediction is planned once for a predictor and a set of input shapes,
+ with persistent input and result buffers.
+ Each run writes into the same result buffers without allocating memory, looking up values,
+ or inferring shapes, making it the fastest way to repeatedly run a predictor on identically shaped inputs,
+ such as video frames.
+*/
+struct FXNBoundPrediction;
+typedef struct FXNBoundPrediction FXNBoundPrediction;
+#pragma endregion
+
+
+#pragma region --Lifecycle--
+/*!
+ @function FXNBoundPredictionCreate
+
+ @abstract Create a bound prediction.
+
+ @discussion Create a bound prediction.
+ The inputs are validated and converted as with `FXNPredictorPrepareInputs`,
+ then the prediction is run once to plan execution and allocate the result buffers.
+ The bound prediction keeps using the predictor model it was created with,
+ even if the predictor model is replaced with `FXNPredictorSwapAsync`.
+
+ @param predictor
+ Predictor. MUST remain valid for the lifetime of the bound prediction.
+
+ @param inputs
+ Prediction inputs with the shapes and data types that every run will use.
+ The inputs are copied, so they can be released immediately.
+
+ @param prediction
+ Created bound prediction.
+ You MUST release the bound prediction with `FXNBoundPredictionRelease` when no longer needed.
+
+ @returns `FXN_OK` if the bound prediction was created.
+ `FXN_ERROR_INVALID_ARGUMENT` if the inputs do not match the predictor signature.
+*/
+FXN_API FXNStatus FXNBoundPredictionCreate (
+    FXNPredictor* predictor,
+    FXNValueMap* inputs,
+    FXNBoundPrediction** prediction
+);
+
+/*!
+ @function FXNBoundPredictionRelease
+
+ @abstract Release a bound prediction.
+
+ @discussion Release a bound prediction.
+
+ @param prediction
+ Bound prediction.
+*/
+FXN_API FXNStatus FXNBoundPredictionRelease (FXNBoundPrediction* prediction);
+#pragma endregion
+
+
+#pragma region --Operations--
+/*!
+ @function FXNBoundPredictionGetInputs
+
+ @abstract Get the input buffers of a bound prediction.
+
+ @discussion Get the input buffers of a bound prediction.
+ Write new input data into the values with `FXNValueGetData` before each run.
+ Value data pointers remain valid for the lifetime of the bound prediction, so they can be retrieved once.
+
+ @param prediction
+ Bound prediction.
+
+ @param inputs
+ Prediction inputs. Do NOT release or modify this value map as it is owned by the bound prediction.
+*/
+FXN_API FXNStatus FXNBoundPredictionGetInputs (
+    FXNBoundPrediction* prediction,
+    FXNValueMap** inputs
+);
+
+/*!
+ @function FXNBoundPredictionGetResults
+
+ @abstract Get the result buffers of a bound prediction.
+
+ @discussion Get the result buffers of a bound prediction.
+ Each run overwrites the data of the result values in place.
+ Value data pointers remain valid for the lifetime of the bound prediction, so they can be retrieved once.
+
+ @param prediction
+ Bound prediction.
+
+ @param results
+ Prediction results. Do NOT release or modify this value map as it is owned by the bound prediction.
+*/
+FXN_API FXNStatus FXNBoundPredictionGetResults (
+    FXNBoundPrediction* prediction,
+    FXNValueMap** results
+);
+
+/*!
+ @function FXNBoundPredictionRun
+
+ @abstract Run a bound prediction.
+
+ @discussion Run a bound prediction on the current contents of its input buffers,
+ writing into its result buffers.
+ A bound prediction MUST NOT be run concurrently from multiple threads.
+
+ @param prediction
+ Bound prediction.
+*/
+FXN_API FXNStatus FXNBoundPredictionRun (FXNBoundPrediction* prediction);
+#pragma endregion
+#endif
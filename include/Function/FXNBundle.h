@@ -0,0 +1,146 @@
+//
+//  FXNBundle.h
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef FXN_MOCK
+#pragma region --Constants--
+/*!
+ @abstract Predictor bundle magic.
+
+ @discussion The first eight bytes of every predictor bundle.
+*/
+#define FXN_BUNDLE_MAGIC "FXNBUNDL"
+
+/*!
+ @abstract Predictor bundle format version.
+*/
+#define FXN_BUNDLE_VERSION 1
+
+/*!
+ @abstract Minimum predictor bundle section alignment in bytes.
+
+ @discussion Section offsets MUST be a multiple of the bundle alignment.
+ The bundle alignment MUST be a power of two that is at least this value.
+ Bundles targeting Apple silicon should use `16384` to match the system page size.
+*/
+#define FXN_BUNDLE_MIN_ALIGNMENT 4096
+#pragma endregion
+
+
+#pragma region --Enumerations--
+/*!
+ @enum FXNBundleSectionType
+
+ @abstract Predictor bundle section type.
+
+ @constant FXN_BUNDLE_SECTION_MANIFEST
+ UTF-8 encoded JSON manifest containing the predictor tag and signature.
+ Every bundle MUST contain exactly one manifest section.
+
+ @constant FXN_BUNDLE_SECTION_CODE
+ Compiled predictor code.
+
+ @constant FXN_BUNDLE_SECTION_WEIGHTS
+ Model weights.
+ The section name is the resource type passed to `FXNConfigurationAddResource`.
+
+ @constant FXN_BUNDLE_SECTION_METADATA
+ Arbitrary predictor metadata.
+*/
+enum FXNBundleSectionType {
+    FXN_BUNDLE_SECTION_MANIFEST = 0,
+    FXN_BUNDLE_SECTION_CODE     = 1,
+    FXN_BUNDLE_SECTION_WEIGHTS  = 2,
+    FXN_BUNDLE_SECTION_METADATA = 3,
+};
+typedef enum FXNBundleSectionType FXNBundleSectionType;
+#pragma endregion
+
+
+#pragma region --Types--
+/*!
+ @struct FXNBundleHeader
+
+ @abstract Predictor bundle header.
+
+ @discussion Predictor bundle header.
+ A predictor bundle is a single little-endian file laid out as follows:
+
+ 1. `FXNBundleHeader` at offset zero.
+ 2. `sectionCount` contiguous `FXNBundleSection` entries immediately following the header.
+ 3. Section data, each starting at an offset which is a multiple of `alignment`.
+
+ Because every section is aligned, the runtime maps the bundle with a single `mmap`
+ and references section data in place without copying.
+
+ @field magic
+ Bundle magic. MUST be `FXN_BUNDLE_MAGIC`.
+
+ @field version
+ Bundle format version. MUST be `FXN_BUNDLE_VERSION`.
+
+ @field sectionCount
+ Number of sections in the bundle.
+
+ @field alignment
+ Section alignment in bytes.
+
+ @field reserved
+ Reserved. MUST be zero.
+
+ @field checksum
+ XXH64 checksum (seed zero) of the section table.
+ Because each section entry contains the checksum of its data, this covers the whole bundle.
+*/
+struct FXNBundleHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t sectionCount;
+    uint32_t alignment;
+    uint32_t reserved;
+    uint64_t checksum;
+};
+typedef struct FXNBundleHeader FXNBundleHeader;
+
+/*!
+ @struct FXNBundleSection
+
+ @abstract Predictor bundle section table entry.
+
+ @field type
+ Section type.
+
+ @field flags
+ Reserved. MUST be zero.
+
+ @field offset
+ Offset of the section data from the start of the bundle in bytes.
+
+ @field size
+ Size of the section data in bytes.
+
+ @field checksum
+ XXH64 checksum (seed zero) of the section data.
+
+ @field name
+ NUL-terminated UTF-8 section name.
+*/
+struct FXNBundleSection {
+    uint32_t type;
+    uint32_t flags;
+    uint64_t offset;
+    uint64_t size;
+    uint64_t checksum;
+    char name[32];
+};
+typedef struct FXNBundleSection FXNBundleSection;
+#pragma endregion
+#endif
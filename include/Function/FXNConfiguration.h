@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <Function/FXNStatus.h>
 
@@ -36,6 +37,82 @@ enum FXNAcceleration {
     FXN_ACCELERATION_NPU    = 1 << 2,
 };
 typedef enum FXNAcceleration FXNAcceleration;
+
+#ifdef FXN_MOCK
+/*!
+ @enum FXNThreadPolicy
+
+ @abstract CPU thread pool used for predictions.
+
+ @constant FXN_THREAD_POLICY_AUTO
+ Use a thread pool owned by the predictor when thread counts, a CPU affinity, or a NUMA node are specified.
+ Otherwise predictions run on the calling thread.
+
+ @constant FXN_THREAD_POLICY_DEDICATED
+ Use a thread pool owned by the predictor.
+
+ @constant FXN_THREAD_POLICY_SHARED
+ Use the process-wide executor shared by all predictors.
+ This prevents predictors from oversubscribing CPU cores.
+ See `FXNRuntimeSetThreadCount`.
+*/
+enum FXNThreadPolicy {
+    FXN_THREAD_POLICY_AUTO      = 0,
+    FXN_THREAD_POLICY_DEDICATED = 1,
+    FXN_THREAD_POLICY_SHARED    = 2,
+};
+typedef enum FXNThreadPolicy FXNThreadPolicy;
+
+/*!
+ @enum FXNPriority
+
+ @abstract Scheduling priority for predictions on the process-wide executor.
+
+ @constant FXN_PRIORITY_NORMAL
+ Normal priority.
+
+ @constant FXN_PRIORITY_LOW
+ Low priority for batch workloads.
+ Work is only scheduled when no higher priority work is pending.
+
+ @constant FXN_PRIORITY_HIGH
+ High priority for latency-critical workloads.
+ Work preempts lower priority work between chunks of work, without waiting for lower priority predictions to complete.
+*/
+enum FXNPriority {
+    FXN_PRIORITY_NORMAL = 0,
+    FXN_PRIORITY_LOW    = 1,
+    FXN_PRIORITY_HIGH   = 2,
+};
+typedef enum FXNPriority FXNPriority;
+
+/*!
+ @enum FXNNUMAPolicy
+
+ @abstract Placement of predictor weights across NUMA nodes.
+
+ @constant FXN_NUMA_POLICY_AUTO
+ Place weights on the NUMA node of the thread that loads the predictor.
+
+ @constant FXN_NUMA_POLICY_INTERLEAVE
+ Interleave weights across all NUMA nodes.
+
+ @constant FXN_NUMA_POLICY_BIND
+ Place weights on the NUMA node specified with `FXNConfigurationSetNUMANode`, which MUST be specified.
+
+ @constant FXN_NUMA_POLICY_REPLICATE
+ Replicate weights on every NUMA node.
+ Predictions read the replica on the NUMA node of the thread which runs them.
+ This multiplies weight memory by the number of NUMA nodes.
+*/
+enum FXNNUMAPolicy {
+    FXN_NUMA_POLICY_AUTO        = 0,
+    FXN_NUMA_POLICY_INTERLEAVE  = 1,
+    FXN_NUMA_POLICY_BIND        = 2,
+    FXN_NUMA_POLICY_REPLICATE   = 3,
+};
+typedef enum FXNNUMAPolicy FXNNUMAPolicy;
+#endif
 #pragma endregion
 
 
@@ -115,6 +192,33 @@ FXN_API FXNStatus FXNConfigurationGetClientID (
 */
 FXN_API FXNStatus FXNConfigurationCreate (FXNConfiguration** configuration);
 
+#ifdef FXN_MOCK
+/*!
+ @function FXNConfigurationCreateFromBundle
+
+ @abstract Create a predictor configuration from a predictor bundle.
+
+ @discussion Create a predictor configuration from a predictor bundle.
+ The bundle is memory-mapped and validated against its checksums.
+ The configuration tag and resources are populated from the bundle manifest,
+ so there is no need to call `FXNConfigurationSetTag` or `FXNConfigurationAddResource`.
+ See `FXNBundle.h` for the bundle format.
+
+ @param path
+ Predictor bundle path.
+
+ @param configuration
+ Created configuration. MUST NOT be `NULL`.
+
+ @returns `FXN_OK` if the configuration was created.
+ `FXN_ERROR_INVALID_ARGUMENT` if the bundle is malformed or fails checksum validation.
+*/
+FXN_API FXNStatus FXNConfigurationCreateFromBundle (
+    const char* path,
+    FXNConfiguration** configuration
+);
+#endif
+
 /*!
  @function FXNConfigurationRelease
 
@@ -289,6 +393,457 @@ FXN_API FXNStatus FXNConfigurationSetDevice (
     void* device
 );
 
+#ifdef FXN_MOCK
+/*!
+ @function FXNConfigurationGetThreadPolicy
+
+ @abstract Get the CPU thread pool used for making predictions.
+
+ @discussion Get the CPU thread pool used for making predictions.
+
+ @param configuration
+ Predictor configuration.
+
+ @param policy
+ Thread policy.
+*/
+FXN_API FXNStatus FXNConfigurationGetThreadPolicy (
+    FXNConfiguration* configuration,
+    FXNThreadPolicy* policy
+);
+
+/*!
+ @function FXNConfigurationSetThreadPolicy
+
+ @abstract Specify the CPU thread pool used for making predictions.
+
+ @discussion Specify the CPU thread pool used for making predictions.
+
+ @param configuration
+ Predictor configuration.
+
+ @param policy
+ Thread policy.
+*/
+FXN_API FXNStatus FXNConfigurationSetThreadPolicy (
+    FXNConfiguration* configuration,
+    FXNThreadPolicy policy
+);
+
+/*!
+ @function FXNConfigurationGetIntraOpThreads
+
+ @abstract Get the number of threads used to parallelize a single operation.
+
+ @discussion Get the number of threads used to parallelize a single operation.
+
+ @param configuration
+ Predictor configuration.
+
+ @param threads
+ Thread count. Zero indicates that the thread count is chosen automatically.
+*/
+FXN_API FXNStatus FXNConfigurationGetIntraOpThreads (
+    FXNConfiguration* configuration,
+    int32_t* threads
+);
+
+/*!
+ @function FXNConfigurationSetIntraOpThreads
+
+ @abstract Specify the number of threads used to parallelize a single operation.
+
+ @discussion Specify the number of threads used to parallelize a single operation.
+ This is the size of the thread pool owned by the predictor,
+ and has no effect when the thread policy is `FXN_THREAD_POLICY_SHARED`.
+
+ @param configuration
+ Predictor configuration.
+
+ @param threads
+ Thread count. Pass zero to use one thread per CPU core that prediction threads are pinned to,
+ or one thread per logical CPU core when prediction threads are not pinned.
+*/
+FXN_API FXNStatus FXNConfigurationSetIntraOpThreads (
+    FXNConfiguration* configuration,
+    int32_t threads
+);
+
+/*!
+ @function FXNConfigurationGetInterOpThreads
+
+ @abstract Get the number of threads used to run independent operations concurrently.
+
+ @discussion Get the number of threads used to run independent operations concurrently.
+
+ @param configuration
+ Predictor configuration.
+
+ @param threads
+ Thread count. Zero indicates that the thread count is chosen automatically.
+*/
+FXN_API FXNStatus FXNConfigurationGetInterOpThreads (
+    FXNConfiguration* configuration,
+    int32_t* threads
+);
+
+/*!
+ @function FXNConfigurationSetInterOpThreads
+
+ @abstract Specify the number of threads used to run independent operations concurrently.
+
+ @discussion Specify the number of threads used to run independent operations concurrently.
+ This bounds the number of predictions which run concurrently on the thread pool,
+ with further predictions waiting for a running prediction to complete.
+
+ @param configuration
+ Predictor configuration.
+
+ @param threads
+ Thread count. Pass zero to run any number of predictions concurrently.
+*/
+FXN_API FXNStatus FXNConfigurationSetInterOpThreads (
+    FXNConfiguration* configuration,
+    int32_t threads
+);
+
+/*!
+ @function FXNConfigurationGetCPUAffinity
+
+ @abstract Get the CPU cores that prediction threads are pinned to.
+
+ @discussion Get the CPU cores that prediction threads are pinned to.
+
+ @param configuration
+ Predictor configuration.
+
+ @param cores
+ Destination array of logical CPU core indices.
+
+ @param size
+ Length of the destination array in elements.
+
+ @param count
+ Number of cores in the affinity set. MUST NOT be `NULL`.
+ Zero indicates that prediction threads are not pinned.
+*/
+FXN_API FXNStatus FXNConfigurationGetCPUAffinity (
+    FXNConfiguration* configuration,
+    int32_t* cores,
+    int32_t size,
+    int32_t* count
+);
+
+/*!
+ @function FXNConfigurationSetCPUAffinity
+
+ @abstract Pin prediction threads to a set of CPU cores.
+
+ @discussion Pin prediction threads to a set of CPU cores.
+ This has no effect when the thread policy is `FXN_THREAD_POLICY_SHARED`.
+ Thread pinning is not supported on iOS, macOS, visionOS, or WebAssembly.
+
+ @param configuration
+ Predictor configuration.
+
+ @param cores
+ Logical CPU core indices. Pass `NULL` to unpin prediction threads.
+
+ @param count
+ Number of cores.
+
+ @returns `FXN_OK` if the affinity was set.
+ `FXN_ERROR_NOT_IMPLEMENTED` if thread pinning is not supported on the current platform.
+*/
+FXN_API FXNStatus FXNConfigurationSetCPUAffinity (
+    FXNConfiguration* configuration,
+    const int32_t* cores,
+    int32_t count
+);
+
+/*!
+ @function FXNConfigurationGetNUMANode
+
+ @abstract Get the NUMA node that prediction threads are pinned to.
+
+ @discussion Get the NUMA node that prediction threads are pinned to.
+
+ @param configuration
+ Predictor configuration.
+
+ @param node
+ NUMA node index. Negative values indicate that prediction threads are not pinned to a NUMA node.
+*/
+FXN_API FXNStatus FXNConfigurationGetNUMANode (
+    FXNConfiguration* configuration,
+    int32_t* node
+);
+
+/*!
+ @function FXNConfigurationSetNUMANode
+
+ @abstract Pin prediction threads to the CPU cores of a NUMA node.
+
+ @discussion Pin prediction threads to the CPU cores of a NUMA node.
+ When both a NUMA node and a CPU affinity are specified, threads are pinned to their intersection.
+ NUMA pinning is only supported on Linux.
+
+ @param configuration
+ Predictor configuration.
+
+ @param node
+ NUMA node index. Pass `-1` to unpin prediction threads from a NUMA node.
+
+ @returns `FXN_OK` if the NUMA node was set.
+ `FXN_ERROR_NOT_IMPLEMENTED` if NUMA pinning is not supported on the current platform.
+*/
+FXN_API FXNStatus FXNConfigurationSetNUMANode (
+    FXNConfiguration* configuration,
+    int32_t node
+);
+
+/*!
+ @function FXNConfigurationGetNUMAPolicy
+
+ @abstract Get the placement of predictor weights across NUMA nodes.
+
+ @discussion Get the placement of predictor weights across NUMA nodes.
+
+ @param configuration
+ Predictor configuration.
+
+ @param policy
+ NUMA policy.
+*/
+FXN_API FXNStatus FXNConfigurationGetNUMAPolicy (
+    FXNConfiguration* configuration,
+    FXNNUMAPolicy* policy
+);
+
+/*!
+ @function FXNConfigurationSetNUMAPolicy
+
+ @abstract Specify the placement of predictor weights across NUMA nodes.
+
+ @discussion Specify the placement of predictor weights across NUMA nodes.
+ NUMA placement is only supported on Linux.
+
+ @param configuration
+ Predictor configuration.
+
+ @param policy
+ NUMA policy.
+
+ @returns `FXN_OK` if the NUMA policy was set.
+ `FXN_ERROR_NOT_IMPLEMENTED` if NUMA placement is not supported on the current platform.
+*/
+FXN_API FXNStatus FXNConfigurationSetNUMAPolicy (
+    FXNConfiguration* configuration,
+    FXNNUMAPolicy policy
+);
+
+/*!
+ @function FXNConfigurationGetPriority
+
+ @abstract Get the scheduling priority used for making predictions.
+
+ @discussion Get the scheduling priority used for making predictions.
+
+ @param configuration
+ Predictor configuration.
+
+ @param priority
+ Scheduling priority.
+*/
+FXN_API FXNStatus FXNConfigurationGetPriority (
+    FXNConfiguration* configuration,
+    FXNPriority* priority
+);
+
+/*!
+ @function FXNConfigurationSetPriority
+
+ @abstract Specify the scheduling priority used for making predictions.
+
+ @discussion Specify the scheduling priority used for making predictions.
+ This only applies when the thread policy is `FXN_THREAD_POLICY_SHARED`.
+
+ @param configuration
+ Predictor configuration.
+
+ @param priority
+ Scheduling priority.
+*/
+FXN_API FXNStatus FXNConfigurationSetPriority (
+    FXNConfiguration* configuration,
+    FXNPriority priority
+);
+
+/*!
+ @function FXNConfigurationGetSchedulingWeight
+
+ @abstract Get the scheduling weight used for making predictions.
+
+ @discussion Get the scheduling weight used for making predictions.
+
+ @param configuration
+ Predictor configuration.
+
+ @param weight
+ Scheduling weight.
+*/
+FXN_API FXNStatus FXNConfigurationGetSchedulingWeight (
+    FXNConfiguration* configuration,
+    int32_t* weight
+);
+
+/*!
+ @function FXNConfigurationSetSchedulingWeight
+
+ @abstract Specify the scheduling weight used for making predictions.
+
+ @discussion Specify the scheduling weight used for making predictions.
+ Predictors with the same priority share the process-wide executor in proportion to their weights.
+ This only applies when the thread policy is `FXN_THREAD_POLICY_SHARED`.
+
+ @param configuration
+ Predictor configuration.
+
+ @param weight
+ Scheduling weight. MUST be positive. Defaults to `1`.
+*/
+FXN_API FXNStatus FXNConfigurationSetSchedulingWeight (
+    FXNConfiguration* configuration,
+    int32_t weight
+);
+
+/*!
+ @function FXNConfigurationGetResultCacheCapacity
+
+ @abstract Get the memory budget of the prediction result cache.
+
+ @discussion Get the memory budget of the prediction result cache.
+
+ @param configuration
+ Predictor configuration.
+
+ @param capacity
+ Result cache capacity in bytes. Zero indicates that the result cache is disabled.
+*/
+FXN_API FXNStatus FXNConfigurationGetResultCacheCapacity (
+    FXNConfiguration* configuration,
+    int64_t* capacity
+);
+
+/*!
+ @function FXNConfigurationSetResultCacheCapacity
+
+ @abstract Specify the memory budget of the prediction result cache.
+
+ @discussion Specify the memory budget of the prediction result cache.
+ When enabled, predictions are cached by their input values,
+ and a prediction whose inputs are equal to those of a cached prediction returns the cached results without running the predictor.
+ Cached results are shared between predictions without being copied, and MUST NOT be modified.
+ The cache capacity accounts for both the inputs and results of cached predictions,
+ and the least recently used predictions are evicted once the cache exceeds its capacity.
+ Only enable the result cache for deterministic predictors.
+
+ @param configuration
+ Predictor configuration.
+
+ @param capacity
+ Result cache capacity in bytes. Pass zero to disable the result cache.
+*/
+FXN_API FXNStatus FXNConfigurationSetResultCacheCapacity (
+    FXNConfiguration* configuration,
+    int64_t capacity
+);
+
+/*!
+ @function FXNConfigurationGetSharedMemoryOutputs
+
+ @abstract Get whether prediction output tensors are written into shared memory.
+
+ @discussion Get whether prediction output tensors are written into shared memory.
+
+ @param configuration
+ Predictor configuration.
+
+ @param enabled
+ Whether output tensors are written into shared memory.
+*/
+FXN_API FXNStatus FXNConfigurationGetSharedMemoryOutputs (
+    FXNConfiguration* configuration,
+    bool* enabled
+);
+
+/*!
+ @function FXNConfigurationSetSharedMemoryOutputs
+
+ @abstract Specify whether prediction output tensors are written into shared memory.
+
+ @discussion Specify whether prediction output tensors are written into shared memory.
+ When enabled, array, image, and binary prediction results are allocated as though they were
+ created with `FXN_VALUE_FLAG_SHARED_MEMORY`, so they can be handed off to another process
+ with `FXNValueGetSharedMemoryName` without copying.
+
+ @param configuration
+ Predictor configuration.
+
+ @param enabled
+ Whether output tensors are written into shared memory.
+*/
+FXN_API FXNStatus FXNConfigurationSetSharedMemoryOutputs (
+    FXNConfiguration* configuration,
+    bool enabled
+);
+
+/*!
+ @function FXNConfigurationGetRecordingPath
+
+ @abstract Get the path of the prediction recording.
+
+ @discussion Get the path of the prediction recording.
+
+ @param configuration
+ Predictor configuration.
+
+ @param path
+ Destination buffer. This is empty if predictions are not recorded.
+
+ @param size
+ Size of destination buffer.
+*/
+FXN_API FXNStatus FXNConfigurationGetRecordingPath (
+    FXNConfiguration* configuration,
+    char* path,
+    int32_t size
+);
+
+/*!
+ @function FXNConfigurationSetRecordingPath
+
+ @abstract Record the inputs and timing of every prediction made by the predictor.
+
+ @discussion Record the inputs and timing of every prediction made by the predictor.
+ Each call to `FXNPredictorCreatePrediction` is appended to a compact binary recording,
+ where value data is deduplicated by checksum so that repeated inputs are only stored once.
+ Use `FXNRecordingCreate` to open the recording for replay.
+ See `FXNRecording.h` for the recording format.
+
+ @param configuration
+ Predictor configuration.
+
+ @param path
+ Path to the recording file, which is created or replaced when the predictor is created.
+ Pass `NULL` to disable recording.
+*/
+FXN_API FXNStatus FXNConfigurationSetRecordingPath (
+    FXNConfiguration* configuration,
+    const char* path
+);
+#endif
+
 /*!
  @function FXNConfigurationAddResource
 
@@ -162,4 +162,5 @@ FXN_API FXNStatus FXNPredictionGetLogLength (
     FXNPrediction* prediction,
     int32_t* length
 );
+
 #pragma endregion
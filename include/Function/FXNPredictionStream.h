@@ -55,9 +55,51 @@ FXN_API FXNStatus FXNPredictionStreamRelease (FXNPredictionStream* stream);
 
  @returns `FXN_OK` a prediction was successfully read from the stream.
  `FXN_ERROR_INVALID_OPERATION` if the stream has no more predictions.
+ For duplex streams, this blocks until a prediction is available
+ or the stream inputs have been closed and every prediction has been read.
 */
 FXN_API FXNStatus FXNPredictionStreamReadNext (
     FXNPredictionStream* stream,
     FXNPrediction** prediction
 );
+
+#ifdef FXN_MOCK
+/*!
+ @function FXNPredictionStreamWriteInputs
+
+ @abstract Write additional inputs into a duplex prediction stream.
+
+ @discussion Write additional inputs into a duplex prediction stream.
+ This can be called from a different thread than the one reading predictions.
+
+ @param stream
+ Prediction stream created with `FXNPredictorCreateDuplexStream`.
+
+ @param inputs
+ Input chunk. The stream copies the inputs, so you remain responsible for releasing the value map.
+
+ @returns `FXN_OK` if the inputs were written.
+ `FXN_ERROR_INVALID_OPERATION` if the stream is not a duplex stream or its inputs have been closed.
+*/
+FXN_API FXNStatus FXNPredictionStreamWriteInputs (
+    FXNPredictionStream* stream,
+    FXNValueMap* inputs
+);
+
+/*!
+ @function FXNPredictionStreamCloseInputs
+
+ @abstract Signal that no more inputs will be written into a duplex prediction stream.
+
+ @discussion Signal that no more inputs will be written into a duplex prediction stream.
+ Predictions for inputs which have already been written can still be read.
+
+ @param stream
+ Prediction stream created with `FXNPredictorCreateDuplexStream`.
+
+ @returns `FXN_OK` if the inputs were closed.
+ `FXN_ERROR_INVALID_OPERATION` if the stream is not a duplex stream.
+*/
+FXN_API FXNStatus FXNPredictionStreamCloseInputs (FXNPredictionStream* stream);
+#endif
 #pragma endregion
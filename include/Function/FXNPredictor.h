@@ -22,6 +22,29 @@
 */
 struct FXNPredictor;
 typedef struct FXNPredictor FXNPredictor;
+
+#ifdef FXN_MOCK
+/*!
+ @typedef FXNPredictorCreateHandler
+
+ @abstract Callback invoked when a predictor has been created.
+
+ @param context
+ User context.
+
+ @param status
+ Result status.
+
+ @param predictor
+ Created predictor. This is `NULL` if creation failed.
+ You MUST release the predictor with `FXNPredictorRelease` when no longer needed.
+*/
+typedef void (*FXNPredictorCreateHandler) (
+    void* context,
+    FXNStatus status,
+    FXNPredictor* predictor
+);
+#endif
 #pragma endregion
 
 
@@ -44,6 +67,74 @@ FXN_API FXNStatus FXNPredictorCreate (
     FXNPredictor** predictor
 );
 
+#ifdef FXN_MOCK
+/*!
+ @function FXNPredictorCreateAsync
+
+ @abstract Create a predictor asynchronously.
+
+ @discussion Create a predictor asynchronously.
+ Configuration resources are mapped and read concurrently with the model weights on a pool of background threads,
+ so creation time is bounded by the largest resource rather than the sum of all resources.
+ This function returns immediately and the handler is invoked on one of the background threads.
+ The handler SHOULD return promptly, since it delays other predictors which are loading.
+
+ @param configuration
+ Predictor configuration.
+ The configuration can be released once this function returns.
+
+ @param handler
+ Callback invoked when the predictor has been created. MUST NOT be `NULL`.
+
+ @param context
+ User context passed to the handler.
+*/
+FXN_API FXNStatus FXNPredictorCreateAsync (
+    FXNConfiguration* configuration,
+    FXNPredictorCreateHandler handler,
+    void* context
+);
+
+/*!
+ @function FXNPredictorSwapAsync
+
+ @abstract Replace the model of a predictor without interrupting predictions.
+
+ @discussion Replace the model of a predictor without interrupting predictions.
+ The new model is loaded on a pool of background threads while the predictor continues serving the current model.
+ Once loaded, new predictions and prediction streams atomically switch to the new model.
+ Predictions and prediction streams which are already in flight complete with the previous model,
+ whose resources are freed as soon as the last of them completes.
+ The predictor handle remains valid throughout, and cached prediction results are discarded.
+ Only the predictor tag and resources are taken from the configuration; all other predictor settings are retained.
+ This function returns immediately and the handler is invoked on one of the background threads.
+ `FXNPredictorRelease` waits for pending swaps of a predictor to complete,
+ so the predictor remains valid until the handler returns.
+ The handler MUST NOT release a predictor with pending swaps, such as the predictor it was invoked for,
+ and `FXNPredictorRelease` fails with `FXN_ERROR_INVALID_OPERATION` when the handler does so.
+
+ @param predictor
+ Predictor.
+
+ @param configuration
+ Configuration of the new model.
+ The configuration can be released once this function returns.
+
+ @param handler
+ Callback invoked when the swap has completed. MUST NOT be `NULL`.
+ If the new model fails to load, the handler receives a `NULL` predictor and the predictor keeps its current model.
+
+ @param context
+ User context passed to the handler.
+*/
+FXN_API FXNStatus FXNPredictorSwapAsync (
+    FXNPredictor* predictor,
+    FXNConfiguration* configuration,
+    FXNPredictorCreateHandler handler,
+    void* context
+);
+#endif
+
 /*!
  @function FXNPredictorRelease
 
@@ -65,6 +156,8 @@ FXN_API FXNStatus FXNPredictorRelease (FXNPredictor* predictor);
  @abstract Create a prediction.
 
  @discussion Create a prediction.
+ Inputs are validated against the predictor signature and converted to the expected data types on every call,
+ unless they were prepared with `FXNPredictorPrepareInputs`.
 
  @param predictor
  Predictor.
@@ -82,6 +175,42 @@ FXN_API FXNStatus FXNPredictorCreatePrediction (
     FXNPrediction** prediction
 );
 
+#ifdef FXN_MOCK
+/*!
+ @function FXNPredictorPrepareInputs
+
+ @abstract Validate and convert prediction inputs once for repeated predictions.
+
+ @discussion Validate and convert prediction inputs once for repeated predictions.
+ The inputs are checked against the predictor signature, and tensors are converted to the data types
+ that the predictor expects (e.g. `float64` to `float32`), so that type and shape mismatches are reported here
+ instead of when making a prediction.
+
+ Predictions made with the prepared inputs skip validation and conversion entirely.
+ To make subsequent predictions with new data of the same shapes, write into the data of the prepared values
+ with `FXNValueGetData`. Adding, replacing, or removing a value in the prepared map reverts it to being
+ validated on every prediction, as does replacing the predictor model with `FXNPredictorSwapAsync`.
+
+ @param predictor
+ Predictor.
+
+ @param inputs
+ Prediction inputs. The inputs are copied, so they can be released immediately.
+
+ @param prepared
+ Prepared inputs, which are bound to the predictor.
+ You MUST release the value map with `FXNValueMapRelease` when no longer needed.
+
+ @returns `FXN_OK` if the inputs were prepared.
+ `FXN_ERROR_INVALID_ARGUMENT` if the inputs do not match the predictor signature.
+*/
+FXN_API FXNStatus FXNPredictorPrepareInputs (
+    FXNPredictor* predictor,
+    FXNValueMap* inputs,
+    FXNValueMap** prepared
+);
+#endif
+
 /*!
  @function FXNPredictorStreamPrediction
 
@@ -105,4 +234,66 @@ FXN_API FXNStatus FXNPredictorStreamPrediction (
     FXNValueMap* inputs,
     FXNPredictionStream** stream
 );
+
+#ifdef FXN_MOCK
+/*!
+ @function FXNPredictorCreateDuplexStream
+
+ @abstract Create a streaming prediction which accepts additional inputs while it runs.
+
+ @discussion Create a streaming prediction which accepts additional inputs while it runs.
+ Use `FXNPredictionStreamWriteInputs` to write input chunks, such as audio or video frames, into the stream
+ as they become available, and `FXNPredictionStreamReadNext` to read predictions as they are produced.
+ Call `FXNPredictionStreamCloseInputs` once no more inputs will be written.
+ `FXNPredictionStreamRelease` wakes readers blocked in `FXNPredictionStreamReadNext`, which fail with
+ `FXN_ERROR_INVALID_OPERATION`, and waits for every in-flight read to return before releasing the stream.
+ Other stream functions MUST NOT be called concurrently with or after `FXNPredictionStreamRelease`.
+ NOTE: This API is currently experimental.
+
+ @param predictor
+ Predictor.
+
+ @param inputs
+ Initial prediction inputs. This can be an empty value map.
+
+ @param stream
+ Prediction stream.
+ You MUST release the prediction stream with `FXNPredictionStreamRelease` when no longer needed.
+*/
+FXN_API FXNStatus FXNPredictorCreateDuplexStream (
+    FXNPredictor* predictor,
+    FXNValueMap* inputs,
+    FXNPredictionStream** stream
+);
+
+/*!
+ @function FXNPredictorGetResultCacheStatistics
+
+ @abstract Get prediction result cache statistics.
+
+ @discussion Get prediction result cache statistics.
+ The hit rate of the result cache is `hits / (hits + misses)`.
+
+ @param predictor
+ Predictor.
+
+ @param hits
+ Number of predictions served from the result cache.
+
+ @param misses
+ Number of predictions which were not found in the result cache.
+
+ @param size
+ Current result cache size in bytes.
+
+ @returns `FXN_OK` if the statistics were retrieved.
+ `FXN_ERROR_INVALID_OPERATION` if the predictor does not have a result cache.
+*/
+FXN_API FXNStatus FXNPredictorGetResultCacheStatistics (
+    FXNPredictor* predictor,
+    int64_t* hits,
+    int64_t* misses,
+    int64_t* size
+);
+#endif
 #pragma endregion
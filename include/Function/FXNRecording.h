@@ -0,0 +1,263 @@
+//
+//  FXNRecording.h
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <Function/FXNValueMap.h>
+
+#ifdef FXN_MOCK
+#pragma region --Constants--
+/*!
+ @abstract Prediction recording magic.
+
+ @discussion The first eight bytes of every prediction recording.
+*/
+#define FXN_RECORDING_MAGIC "FXNRECRD"
+
+/*!
+ @abstract Prediction recording format version.
+*/
+#define FXN_RECORDING_VERSION 1
+#pragma endregion
+
+
+#pragma region --Enumerations--
+/*!
+ @enum FXNRecordingRecordType
+
+ @abstract Prediction recording record type.
+
+ @constant FXN_RECORDING_RECORD_BLOB
+ Value data, identified by its XXH64 checksum (seed zero).
+ The record payload is the `uint64_t` checksum followed by the value data.
+ Each distinct blob is written once, before the first prediction which references it.
+
+ @constant FXN_RECORDING_RECORD_PREDICTION
+ Prediction inputs and timing.
+ The record payload is an `FXNRecordingPrediction` followed by `valueCount` input values.
+ Each input value is an `FXNRecordingValue`, followed by the UTF-8 encoded key without a null terminator,
+ followed by `dims` `int32_t` shape dimensions.
+*/
+enum FXNRecordingRecordType {
+    FXN_RECORDING_RECORD_BLOB       = 0,
+    FXN_RECORDING_RECORD_PREDICTION = 1,
+};
+typedef enum FXNRecordingRecordType FXNRecordingRecordType;
+#pragma endregion
+
+
+#pragma region --Types--
+/*!
+ @struct FXNRecordingHeader
+
+ @abstract Prediction recording header.
+
+ @discussion Prediction recording header.
+ A prediction recording is a single little-endian file containing an `FXNRecordingHeader` at offset zero,
+ followed by a sequence of records. Each record starts with an `FXNRecordingRecord` header
+ and is immediately followed by its payload. Each record is padded with zeros to a multiple of eight bytes,
+ so that blob data is eight-byte aligned. The padding is not included in the record size.
+
+ @field magic
+ Recording magic. MUST be `FXN_RECORDING_MAGIC`.
+
+ @field version
+ Recording format version. MUST be `FXN_RECORDING_VERSION`.
+
+ @field reserved
+ Reserved. MUST be zero.
+*/
+struct FXNRecordingHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t reserved;
+};
+typedef struct FXNRecordingHeader FXNRecordingHeader;
+
+/*!
+ @struct FXNRecordingRecord
+
+ @abstract Prediction recording record header.
+
+ @field type
+ Record type.
+
+ @field reserved
+ Reserved. MUST be zero.
+
+ @field size
+ Size of the record payload in bytes.
+*/
+struct FXNRecordingRecord {
+    uint32_t type;
+    uint32_t reserved;
+    uint64_t size;
+};
+typedef struct FXNRecordingRecord FXNRecordingRecord;
+
+/*!
+ @struct FXNRecordingPrediction
+
+ @abstract Recorded prediction.
+
+ @field timestamp
+ Time at which the prediction was requested, in milliseconds since the first recorded prediction.
+
+ @field latency
+ Prediction latency in milliseconds.
+
+ @field valueCount
+ Number of input values.
+
+ @field reserved
+ Reserved. MUST be zero.
+*/
+struct FXNRecordingPrediction {
+    double timestamp;
+    double latency;
+    uint32_t valueCount;
+    uint32_t reserved;
+};
+typedef struct FXNRecordingPrediction FXNRecordingPrediction;
+
+/*!
+ @struct FXNRecordingValue
+
+ @abstract Recorded prediction input value.
+
+ @field type
+ Value data type.
+
+ @field dims
+ Number of shape dimensions.
+
+ @field keyLength
+ Length of the value key in bytes.
+
+ @field reserved
+ Reserved. MUST be zero.
+
+ @field size
+ Size of the value data in bytes.
+
+ @field checksum
+ XXH64 checksum (seed zero) of the value data, identifying a blob record.
+*/
+struct FXNRecordingValue {
+    uint32_t type;
+    uint32_t dims;
+    uint32_t keyLength;
+    uint32_t reserved;
+    uint64_t size;
+    uint64_t checksum;
+};
+typedef struct FXNRecordingValue FXNRecordingValue;
+
+/*!
+ @struct FXNRecording
+
+ @abstract Prediction recording.
+
+ @discussion Prediction recording, created by predictors configured with `FXNConfigurationSetRecordingPath`.
+*/
+struct FXNRecording;
+typedef struct FXNRecording FXNRecording;
+#pragma endregion
+
+
+#pragma region --Lifecycle--
+/*!
+ @function FXNRecordingCreate
+
+ @abstract Open a prediction recording.
+
+ @discussion Open a prediction recording.
+
+ @param path
+ Path to the recording file.
+
+ @param recording
+ Recording.
+ You MUST release the recording with `FXNRecordingRelease` when no longer needed.
+
+ @returns `FXN_OK` if the recording was opened.
+ `FXN_ERROR_INVALID_ARGUMENT` if the file is not a valid prediction recording.
+*/
+FXN_API FXNStatus FXNRecordingCreate (
+    const char* path,
+    FXNRecording** recording
+);
+
+/*!
+ @function FXNRecordingRelease
+
+ @abstract Release a prediction recording.
+
+ @discussion Release a prediction recording.
+
+ @param recording
+ Recording.
+*/
+FXN_API FXNStatus FXNRecordingRelease (FXNRecording* recording);
+#pragma endregion
+
+
+#pragma region --Operations--
+/*!
+ @function FXNRecordingGetCount
+
+ @abstract Get the number of predictions in a recording.
+
+ @discussion Get the number of predictions in a recording.
+
+ @param recording
+ Recording.
+
+ @param count
+ Number of recorded predictions.
+*/
+FXN_API FXNStatus FXNRecordingGetCount (
+    FXNRecording* recording,
+    int32_t* count
+);
+
+/*!
+ @function FXNRecordingGetPrediction
+
+ @abstract Get a recorded prediction.
+
+ @discussion Get a recorded prediction.
+ To replay a recording, pass the inputs to `FXNPredictorCreatePrediction`,
+ waiting until each timestamp (optionally scaled to accelerate the replay) before doing so.
+
+ @param recording
+ Recording.
+
+ @param index
+ Prediction index.
+
+ @param inputs
+ Prediction inputs. Do NOT release this value map as it is owned by the recording.
+ Values reference the recording data without copying.
+
+ @param timestamp
+ Time at which the prediction was requested, in milliseconds since the first recorded prediction.
+
+ @param latency
+ Recorded prediction latency in milliseconds.
+*/
+FXN_API FXNStatus FXNRecordingGetPrediction (
+    FXNRecording* recording,
+    int32_t index,
+    FXNValueMap** inputs,
+    double* timestamp,
+    double* latency
+);
+#pragma endregion
+#endif
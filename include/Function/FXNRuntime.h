@@ -0,0 +1,141 @@
+//
+//  FXNRuntime.h
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <Function/FXNStatus.h>
+
+#ifdef FXN_MOCK
+struct FXNPredictor;
+
+#pragma region --Types--
+/*!
+ @typedef FXNRuntimeResidencyHandler
+
+ @abstract Callback invoked when the weights of a predictor are evicted from or reloaded into memory.
+
+ @param context
+ User context.
+
+ @param predictor
+ Predictor whose weights were evicted or reloaded.
+
+ @param resident
+ Whether the predictor weights were reloaded (`true`) or evicted (`false`).
+*/
+typedef void (*FXNRuntimeResidencyHandler) (
+    void* context,
+    struct FXNPredictor* predictor,
+    bool resident
+);
+#pragma endregion
+
+
+#pragma region --Executor--
+/*!
+ @function FXNRuntimeGetThreadCount
+
+ @abstract Get the number of worker threads in the process-wide executor.
+
+ @discussion Get the number of worker threads in the process-wide executor.
+ Predictors created with `FXN_THREAD_POLICY_SHARED` schedule work onto this executor.
+
+ @param threads
+ Worker thread count.
+*/
+FXN_API FXNStatus FXNRuntimeGetThreadCount (int32_t* threads);
+
+/*!
+ @function FXNRuntimeSetThreadCount
+
+ @abstract Specify the number of worker threads in the process-wide executor.
+
+ @discussion Specify the number of worker threads in the process-wide executor.
+ The executor is a thread pool shared by all predictors created with `FXN_THREAD_POLICY_SHARED`.
+ Predictions are split into chunks of work which idle workers take from any busy predictor,
+ so idle predictors hold no threads while a busy predictor can saturate every worker.
+ This MUST be called before the first shared predictor is created.
+
+ @param threads
+ Worker thread count. Pass zero to use one thread per logical CPU core.
+
+ @returns `FXN_OK` if the thread count was set.
+ `FXN_ERROR_INVALID_OPERATION` if the executor has already started.
+*/
+FXN_API FXNStatus FXNRuntimeSetThreadCount (int32_t threads);
+#pragma endregion
+
+
+#pragma region --Memory--
+/*!
+ @function FXNRuntimeGetMemoryBudget
+
+ @abstract Get the process-wide memory budget for predictor weights.
+
+ @discussion Get the process-wide memory budget for predictor weights.
+
+ @param bytes
+ Memory budget in bytes. Zero indicates that the memory budget is unlimited.
+*/
+FXN_API FXNStatus FXNRuntimeGetMemoryBudget (int64_t* bytes);
+
+/*!
+ @function FXNRuntimeSetMemoryBudget
+
+ @abstract Specify the process-wide memory budget for predictor weights.
+
+ @discussion Specify the process-wide memory budget for predictor weights.
+ When resident predictor weights exceed the budget, the weights of the least recently used idle predictors
+ are evicted from memory. A predictor is idle when it has no in-flight predictions or open prediction streams.
+ Evicted predictors remain valid, and their weights are transparently reloaded on their next prediction.
+ The budget can be temporarily exceeded when every resident predictor is in use.
+
+ @param bytes
+ Memory budget in bytes. Pass zero to disable eviction.
+*/
+FXN_API FXNStatus FXNRuntimeSetMemoryBudget (int64_t bytes);
+
+/*!
+ @function FXNRuntimeGetMemoryUsage
+
+ @abstract Get the size of all resident predictor weights.
+
+ @discussion Get the size of all resident predictor weights.
+
+ @param bytes
+ Resident predictor weight size in bytes.
+*/
+FXN_API FXNStatus FXNRuntimeGetMemoryUsage (int64_t* bytes);
+
+/*!
+ @function FXNRuntimeSetResidencyHandler
+
+ @abstract Specify a callback invoked when predictor weights are evicted or reloaded.
+
+ @discussion Specify a callback invoked when predictor weights are evicted or reloaded.
+ The handler is invoked on the thread which caused the eviction or reload,
+ after the runtime has released its internal locks.
+ `FXNPredictorRelease` waits for pending notifications of a predictor to complete,
+ so the predictor passed to the handler remains valid until the handler returns.
+ The handler MUST NOT release a predictor with pending notifications, such as the predictor it was invoked for,
+ and `FXNPredictorRelease` fails with `FXN_ERROR_INVALID_OPERATION` when the handler does so.
+
+ @param handler
+ Residency handler. Pass `NULL` to remove the handler.
+
+ @param context
+ User context passed to the handler.
+*/
+FXN_API FXNStatus FXNRuntimeSetResidencyHandler (
+    FXNRuntimeResidencyHandler handler,
+    void* context
+);
+#pragma endregion
+#endif
@@ -60,10 +60,12 @@
  Value is a UTF-8 encoded string.
 
  @constant FXN_DTYPE_LIST
- Value is a JSON-serializable list.
+ Value is a list.
+ The value data is the JSON encoding of the list.
 
  @constant FXN_DTYPE_DICT
- Value is a JSON-serializable dictionary.
+ Value is a dictionary.
+ The value data is the JSON encoding of the dictionary.
 
  @constant FXN_DTYPE_IMAGE
  Value is a pixel buffer with 8 bits per intensity, interleaved by channel.
@@ -104,10 +106,20 @@ typedef enum FXNDtype FXNDtype;
  @constant FXN_VALUE_FLAG_COPY_DATA
  Copy input data when creating the value.
  When this flag is not set, the value data MUST remain valid for the lifetime of the created value.
+
+ @constant FXN_VALUE_FLAG_SHARED_MEMORY
+ Allocate the value data in a named shared memory region.
+ Input data is copied into the region, so `FXN_VALUE_FLAG_COPY_DATA` is implied.
+ Use `FXNValueGetSharedMemoryName` to get the region name, and `FXNValueCreateFromSharedMemory`
+ to access the value data from another process without copying.
+ This only applies to array, image, and binary values.
 */
 enum FXNValueFlags {
-    FXN_VALUE_FLAG_NONE         = 0,
-    FXN_VALUE_FLAG_COPY_DATA    = 1,
+    FXN_VALUE_FLAG_NONE             = 0,
+    FXN_VALUE_FLAG_COPY_DATA        = 1,
+#ifdef FXN_MOCK
+    FXN_VALUE_FLAG_SHARED_MEMORY    = 2,
+#endif
 };
 typedef enum FXNValueFlags FXNValueFlags;
 #pragma endregion
@@ -218,6 +230,89 @@ FXN_API FXNStatus FXNValueGetShape (
     int32_t* shape,
     int32_t shapeLen
 );
+
+#ifdef FXN_MOCK
+/*!
+ @function FXNValueGetListLength
+
+ @abstract Get the number of items in a list value.
+
+ @discussion Get the number of items in a list value.
+
+ @param value
+ List value.
+
+ @param length
+ Number of items in the list.
+
+ @returns `FXN_OK` if the length was retrieved.
+ `FXN_ERROR_INVALID_OPERATION` if the value is not a list.
+*/
+FXN_API FXNStatus FXNValueGetListLength (
+    FXNValue* value,
+    int32_t* length
+);
+
+/*!
+ @function FXNValueGetListItem
+
+ @abstract Get the item at a given index in a list value.
+
+ @discussion Get the item at a given index in a list value.
+ Lists created from JSON are decoded into items when first accessed.
+ Numbers are decoded as `FXN_DTYPE_INT64` or `FXN_DTYPE_FLOAT64` scalars,
+ booleans as `FXN_DTYPE_BOOL` scalars, and nested lists and dictionaries as list and dictionary values.
+ Decoding is lazy: nested lists and dictionaries are skipped over without being decoded
+ until their own items are accessed, so unused fields are never materialized.
+
+ @param value
+ List value.
+
+ @param index
+ Item index. MUST be less than the list length.
+
+ @param item
+ List item. Do NOT release this value as it is owned by the list.
+
+ @returns `FXN_OK` if the item was retrieved.
+ `FXN_ERROR_INVALID_OPERATION` if the value is not a list.
+ `FXN_ERROR_INVALID_ARGUMENT` if the index is out of range.
+*/
+FXN_API FXNStatus FXNValueGetListItem (
+    FXNValue* value,
+    int32_t index,
+    FXNValue** item
+);
+
+/*!
+ @function FXNValueGetSharedMemoryName
+
+ @abstract Get the name of the shared memory region containing the value data.
+
+ @discussion Get the name of the shared memory region containing the value data.
+ The name can be passed to another process, which can then access the value data
+ with `FXNValueCreateFromSharedMemory`.
+ The region is removed when the value which created it is released,
+ so the value MUST remain alive until the other process has opened the region.
+
+ @param value
+ Value.
+
+ @param name
+ Destination UTF-8 string.
+
+ @param size
+ Size of the destination buffer.
+
+ @returns `FXN_OK` if the name was retrieved.
+ `FXN_ERROR_INVALID_OPERATION` if the value data is not in shared memory.
+*/
+FXN_API FXNStatus FXNValueGetSharedMemoryName (
+    FXNValue* value,
+    char* name,
+    int32_t size
+);
+#endif
 #pragma endregion
 
 
@@ -295,6 +390,38 @@ FXN_API FXNStatus FXNValueCreateList (
     FXNValue** value
 );
 
+#ifdef FXN_MOCK
+/*!
+ @function FXNValueCreateListFromValues
+
+ @abstract Create a list value from a sequence of values.
+
+ @discussion Create a list value from a sequence of values.
+ Unlike `FXNValueCreateList`, this does not require serializing the list to JSON.
+ Tensor items created without `FXN_VALUE_FLAG_COPY_DATA` are referenced without copying.
+ `FXNValueGetData` returns the JSON encoding of the list, which is created when requested and reflects its current items.
+ The encoding remains valid until the list is modified and `FXNValueGetData` is called again.
+
+ NOTE: The list takes ownership of the items.
+ As such, you must not call `FXNValueRelease` on the items.
+
+ @param items
+ List items. Can be `NULL` if `count` is zero.
+
+ @param count
+ Number of items.
+
+ @param value
+ Created value.
+ The value `type` will be `FXN_DTYPE_LIST`.
+*/
+FXN_API FXNStatus FXNValueCreateListFromValues (
+    FXNValue** items,
+    int32_t count,
+    FXNValue** value
+);
+#endif
+
 /*!
  @function FXNValueCreateDict
 
@@ -377,6 +504,43 @@ FXN_API FXNStatus FXNValueCreateBinary (
     FXNValue** value
 );
 
+#ifdef FXN_MOCK
+/*!
+ @function FXNValueCreateFromSharedMemory
+
+ @abstract Create an array value backed by a shared memory region.
+
+ @discussion Create an array value backed by a named shared memory region
+ created by another value with `FXN_VALUE_FLAG_SHARED_MEMORY`, possibly in another process.
+ The value data is mapped without copying, so writes are visible to every process which maps the region.
+
+ @param name
+ Shared memory region name from `FXNValueGetSharedMemoryName`.
+
+ @param shape
+ Array shape.
+
+ @param dims
+ Number of dimensions in the array.
+
+ @param dtype
+ Array data type.
+
+ @param value
+ Created value.
+
+ @returns `FXN_OK` if the value was created.
+ `FXN_ERROR_INVALID_ARGUMENT` if the region does not exist or is smaller than the array.
+*/
+FXN_API FXNStatus FXNValueCreateFromSharedMemory (
+    const char* name,
+    const int32_t* shape,
+    int32_t dims,
+    FXNDtype dtype,
+    FXNValue** value
+);
+#endif
+
 /*!
  @function FXNValueCreateNull
 
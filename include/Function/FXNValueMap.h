@@ -146,3 +146,57 @@ FXN_API FXNStatus FXNValueMapSetValue (
     FXNValue* value
 );
 #pragma endregion
+
+
+#pragma region --Dictionaries--
+#ifdef FXN_MOCK
+/*!
+ @function FXNValueCreateDictFromValueMap
+
+ @abstract Create a dictionary value from a value map.
+
+ @discussion Create a dictionary value from a value map.
+ Unlike `FXNValueCreateDict`, this does not require serializing the dictionary to JSON.
+ Tensor values created without `FXN_VALUE_FLAG_COPY_DATA` are referenced without copying.
+ `FXNValueGetData` returns the JSON encoding of the dictionary, which is created when requested and reflects its current items.
+ The encoding remains valid until the dictionary is modified and `FXNValueGetData` is called again.
+
+ NOTE: The dictionary takes ownership of the value map.
+ As such, you must not call `FXNValueMapRelease` on the value map.
+
+ @param map
+ Dictionary entries.
+
+ @param value
+ Created value.
+ The value `type` will be `FXN_DTYPE_DICT`.
+*/
+FXN_API FXNStatus FXNValueCreateDictFromValueMap (
+    FXNValueMap* map,
+    FXNValue** value
+);
+
+/*!
+ @function FXNValueGetDictValueMap
+
+ @abstract Get the entries of a dictionary value.
+
+ @discussion Get the entries of a dictionary value.
+ Dictionaries created from JSON are decoded into entries when first accessed.
+ See `FXNValueGetListItem` for how JSON is decoded.
+
+ @param value
+ Dictionary value.
+
+ @param map
+ Dictionary entries. Do NOT release this value map as it is owned by the dictionary.
+
+ @returns `FXN_OK` if the entries were retrieved.
+ `FXN_ERROR_INVALID_OPERATION` if the value is not a dictionary.
+*/
+FXN_API FXNStatus FXNValueGetDictValueMap (
+    FXNValue* value,
+    FXNValueMap** map
+);
+#endif
+#pragma endregion
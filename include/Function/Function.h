@@ -9,10 +9,15 @@
 #pragma once
 
 #include <Function/FXNStatus.h>
+#include <Function/FXNBundle.h>
 #include <Function/FXNValue.h>
 #include <Function/FXNValueMap.h>
 #include <Function/FXNConfiguration.h>
 #include <Function/FXNPrediction.h>
 #include <Function/FXNPredictionStream.h>
 #include <Function/FXNPredictor.h>
+#include <Function/FXNBatcher.h>
+#include <Function/FXNBoundPrediction.h>
+#include <Function/FXNRecording.h>
+#include <Function/FXNRuntime.h>
 #include <Function/FXNVersion.h>
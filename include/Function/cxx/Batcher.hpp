@@ -0,0 +1,48 @@
+//
+//  Batcher.hpp
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#pragma once
+
+#include <Function/FXNBatcher.h>
+#include <Function/cxx/Predictor.hpp>
+
+#ifdef FXN_MOCK
+namespace Function {
+
+    /*!
+     @class Batcher
+
+     @abstract Dynamic micro-batching scheduler for a predictor.
+    */
+    class Batcher : public Detail::Handle<FXNBatcher, FXNBatcherRelease> {
+
+    public:
+        using Handle::Handle;
+
+        /*!
+         @abstract Create a batcher.
+
+         @discussion The predictor MUST outlive the batcher.
+        */
+        static Batcher Create (const Predictor& predictor, int32_t maxBatchSize, int32_t maxDelay) {
+            FXNBatcher* batcher = nullptr;
+            Detail::Check(FXNBatcherCreate(predictor, maxBatchSize, maxDelay, &batcher), "Failed to create batcher");
+            return Batcher(batcher);
+        }
+
+        /*!
+         @abstract Create a prediction as part of a batch.
+        */
+        Prediction Predict (const ValueMap& inputs) const {
+            FXNPrediction* prediction = nullptr;
+            Detail::Check(FXNBatcherCreatePrediction(handle, inputs, &prediction), "Failed to create batched prediction");
+            return Prediction(prediction);
+        }
+    };
+}
+#endif
@@ -0,0 +1,68 @@
+//
+//  BoundPrediction.hpp
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#pragma once
+
+#include <Function/FXNBoundPrediction.h>
+#include <Function/cxx/Predictor.hpp>
+
+#ifdef FXN_MOCK
+namespace Function {
+
+    /*!
+     @class BoundPrediction
+
+     @abstract Prediction bound to fixed input shapes, with persistent input and result buffers.
+    */
+    class BoundPrediction : public Detail::Handle<FXNBoundPrediction, FXNBoundPredictionRelease> {
+
+    public:
+        using Handle::Handle;
+
+        /*!
+         @abstract Create a bound prediction.
+
+         @discussion The predictor MUST outlive the bound prediction.
+        */
+        static BoundPrediction Create (const Predictor& predictor, const ValueMap& inputs) {
+            FXNBoundPrediction* prediction = nullptr;
+            Detail::Check(FXNBoundPredictionCreate(predictor, inputs, &prediction), "Failed to create bound prediction");
+            return BoundPrediction(prediction);
+        }
+
+        /*!
+         @abstract Get the input buffers.
+
+         @discussion The returned value map is owned by the bound prediction.
+        */
+        ValueMap GetInputs () const {
+            FXNValueMap* map = nullptr;
+            Detail::Check(FXNBoundPredictionGetInputs(handle, &map), "Failed to get bound prediction inputs");
+            return ValueMap(map, false);
+        }
+
+        /*!
+         @abstract Get the result buffers.
+
+         @discussion The returned value map is owned by the bound prediction.
+        */
+        ValueMap GetResults () const {
+            FXNValueMap* map = nullptr;
+            Detail::Check(FXNBoundPredictionGetResults(handle, &map), "Failed to get bound prediction results");
+            return ValueMap(map, false);
+        }
+
+        /*!
+         @abstract Run the prediction on the current input buffers.
+        */
+        void Run () const {
+            Detail::Check(FXNBoundPredictionRun(handle), "Failed to run bound prediction");
+        }
+    };
+}
+#endif
@@ -0,0 +1,192 @@
+//
+//  Configuration.hpp
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#pragma once
+
+#include <Function/FXNConfiguration.h>
+#include <Function/cxx/Status.hpp>
+
+namespace Function {
+
+    /*!
+     @class Configuration
+
+     @abstract Predictor configuration.
+    */
+    class Configuration : public Detail::Handle<FXNConfiguration, FXNConfigurationRelease> {
+
+    public:
+        using Handle::Handle;
+
+        /*!
+         @abstract Create a predictor configuration.
+        */
+        static Configuration Create () {
+            FXNConfiguration* configuration = nullptr;
+            Detail::Check(FXNConfigurationCreate(&configuration), "Failed to create configuration");
+            return Configuration(configuration);
+        }
+
+#ifdef FXN_MOCK
+        /*!
+         @abstract Create a predictor configuration from a predictor bundle.
+        */
+        static Configuration CreateFromBundle (const char* path) {
+            FXNConfiguration* configuration = nullptr;
+            Detail::Check(FXNConfigurationCreateFromBundle(path, &configuration), "Failed to create configuration from bundle");
+            return Configuration(configuration);
+        }
+#endif
+
+        /*!
+         @abstract Copy the predictor tag into a destination buffer.
+        */
+        void GetTag (char* tag, int32_t size) const {
+            Detail::Check(FXNConfigurationGetTag(handle, tag, size), "Failed to get configuration tag");
+        }
+
+        /*!
+         @abstract Set the predictor tag.
+        */
+        void SetTag (const char* tag) {
+            Detail::Check(FXNConfigurationSetTag(handle, tag), "Failed to set configuration tag");
+        }
+
+        /*!
+         @abstract Copy the configuration token into a destination buffer.
+        */
+        void GetToken (char* token, int32_t size) const {
+            Detail::Check(FXNConfigurationGetToken(handle, token, size), "Failed to get configuration token");
+        }
+
+        /*!
+         @abstract Set the configuration token.
+        */
+        void SetToken (const char* token) {
+            Detail::Check(FXNConfigurationSetToken(handle, token), "Failed to set configuration token");
+        }
+
+        /*!
+         @abstract Get the acceleration used for making predictions.
+        */
+        FXNAcceleration GetAcceleration () const {
+            FXNAcceleration acceleration = FXN_ACCELERATION_AUTO;
+            Detail::Check(FXNConfigurationGetAcceleration(handle, &acceleration), "Failed to get configuration acceleration");
+            return acceleration;
+        }
+
+        /*!
+         @abstract Specify the acceleration used for making predictions.
+        */
+        void SetAcceleration (FXNAcceleration acceleration) {
+            Detail::Check(FXNConfigurationSetAcceleration(handle, acceleration), "Failed to set configuration acceleration");
+        }
+
+        /*!
+         @abstract Get the compute device used for compute acceleration.
+        */
+        void* GetDevice () const {
+            void* device = nullptr;
+            Detail::Check(FXNConfigurationGetDevice(handle, &device), "Failed to get configuration device");
+            return device;
+        }
+
+        /*!
+         @abstract Specify the compute device used for compute acceleration.
+        */
+        void SetDevice (void* device) {
+            Detail::Check(FXNConfigurationSetDevice(handle, device), "Failed to set configuration device");
+        }
+
+#ifdef FXN_MOCK
+        /*!
+         @abstract Specify the CPU thread pool used for making predictions.
+        */
+        void SetThreadPolicy (FXNThreadPolicy policy) {
+            Detail::Check(FXNConfigurationSetThreadPolicy(handle, policy), "Failed to set configuration thread policy");
+        }
+
+        /*!
+         @abstract Specify the number of threads used to parallelize a single operation.
+        */
+        void SetIntraOpThreads (int32_t threads) {
+            Detail::Check(FXNConfigurationSetIntraOpThreads(handle, threads), "Failed to set configuration intra-op threads");
+        }
+
+        /*!
+         @abstract Specify the number of threads used to run independent operations concurrently.
+        */
+        void SetInterOpThreads (int32_t threads) {
+            Detail::Check(FXNConfigurationSetInterOpThreads(handle, threads), "Failed to set configuration inter-op threads");
+        }
+
+        /*!
+         @abstract Pin prediction threads to a set of CPU cores.
+        */
+        void SetCPUAffinity (const int32_t* cores, int32_t count) {
+            Detail::Check(FXNConfigurationSetCPUAffinity(handle, cores, count), "Failed to set configuration CPU affinity");
+        }
+
+        /*!
+         @abstract Pin prediction threads to the CPU cores of a NUMA node.
+        */
+        void SetNUMANode (int32_t node) {
+            Detail::Check(FXNConfigurationSetNUMANode(handle, node), "Failed to set configuration NUMA node");
+        }
+
+        /*!
+         @abstract Specify the placement of predictor weights across NUMA nodes.
+        */
+        void SetNUMAPolicy (FXNNUMAPolicy policy) {
+            Detail::Check(FXNConfigurationSetNUMAPolicy(handle, policy), "Failed to set configuration NUMA policy");
+        }
+
+        /*!
+         @abstract Specify the scheduling priority used for making predictions.
+        */
+        void SetPriority (FXNPriority priority) {
+            Detail::Check(FXNConfigurationSetPriority(handle, priority), "Failed to set configuration priority");
+        }
+
+        /*!
+         @abstract Specify the scheduling weight used for making predictions.
+        */
+        void SetSchedulingWeight (int32_t weight) {
+            Detail::Check(FXNConfigurationSetSchedulingWeight(handle, weight), "Failed to set configuration scheduling weight");
+        }
+
+        /*!
+         @abstract Specify the memory budget of the prediction result cache in bytes.
+        */
+        void SetResultCacheCapacity (int64_t capacity) {
+            Detail::Check(FXNConfigurationSetResultCacheCapacity(handle, capacity), "Failed to set configuration result cache capacity");
+        }
+
+        /*!
+         @abstract Specify whether prediction output tensors are written into shared memory.
+        */
+        void SetSharedMemoryOutputs (bool enabled) {
+            Detail::Check(FXNConfigurationSetSharedMemoryOutputs(handle, enabled), "Failed to set configuration shared memory outputs");
+        }
+
+        /*!
+         @abstract Record the inputs and timing of every prediction made by the predictor.
+        */
+        void SetRecordingPath (const char* path) {
+            Detail::Check(FXNConfigurationSetRecordingPath(handle, path), "Failed to set configuration recording path");
+        }
+#endif
+
+        /*!
+         @abstract Add a prediction resource.
+        */
+        void AddResource (const char* type, const char* path) {
+            Detail::Check(FXNConfigurationAddResource(handle, type, path), "Failed to add configuration resource");
+        }
+    };
+}
@@ -0,0 +1,206 @@
+//
+//  Coroutine.hpp
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#pragma once
+
+// MSVC only reports the language standard in `__cplusplus` with `/Zc:__cplusplus`
+#if ((defined(_MSVC_LANG) && _MSVC_LANG >= 202002L) || __cplusplus >= 202002L) && __has_include(<coroutine>)
+
+#include <algorithm>
+#include <condition_variable>
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <Function/cxx/Predictor.hpp>
+
+namespace Function {
+
+    /*!
+     @class ThreadPoolExecutor
+
+     @abstract Executor which runs work items on a fixed number of threads.
+
+     @discussion Any type with a `Post` method accepting a `void()` callable can be used as an executor.
+     Servers should pass their own executor so that coroutines resume on their threads.
+     The C API is blocking, so each awaited call occupies a pool thread until it completes,
+     and the pool SHOULD have a thread for every call which is expected to be in flight at once.
+     Work which is pending when the executor is destroyed is run before the destructor returns,
+     so the executor MUST outlive the coroutines which await on it.
+     The executor can be destroyed by work running on one of its own threads,
+     in which case that thread is detached instead of joined.
+    */
+    class ThreadPoolExecutor {
+
+    public:
+        explicit ThreadPoolExecutor (size_t threads = std::max(1u, std::thread::hardware_concurrency())) {
+            for (size_t i = 0; i < threads; ++i)
+                workers.emplace_back([this] { Run(); });
+        }
+
+        ThreadPoolExecutor (const ThreadPoolExecutor&) = delete;
+        ThreadPoolExecutor& operator= (const ThreadPoolExecutor&) = delete;
+
+        ~ThreadPoolExecutor () {
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                stopping = true;
+            }
+            available.notify_all();
+            // A worker cannot join itself, so it leaves the pool once the work destroying the executor returns
+            for (auto& worker : workers) {
+                if (worker.get_id() != std::this_thread::get_id())
+                    worker.join();
+                else {
+                    current = nullptr;
+                    worker.detach();
+                }
+            }
+            // Without other workers, pending work runs on the destroying thread
+            for (; !queue.empty(); queue.pop_front())
+                queue.front()();
+        }
+
+        template <typename F>
+        void Post (F&& work) {
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                queue.emplace_back(std::forward<F>(work));
+            }
+            available.notify_one();
+        }
+
+    private:
+        std::mutex lock;
+        std::condition_variable available;
+        std::deque<std::function<void()>> queue;
+        std::vector<std::thread> workers;
+        bool stopping = false;
+        static inline thread_local ThreadPoolExecutor* current = nullptr;
+
+        void Run () {
+            current = this;
+            for (;;) {
+                std::function<void()> work;
+                {
+                    std::unique_lock<std::mutex> guard(lock);
+                    available.wait(guard, [this] { return stopping || !queue.empty(); });
+                    if (queue.empty())
+                        return;
+                    work = std::move(queue.front());
+                    queue.pop_front();
+                }
+                work();
+                work = nullptr;
+                // The work destroyed the executor, so its members MUST NOT be accessed
+                if (current != this)
+                    return;
+            }
+        }
+    };
+
+    namespace Detail {
+
+        /*!
+         @class Operation
+
+         @abstract Awaitable which runs a blocking C API call on an executor.
+
+         @discussion The awaiting coroutine is suspended, the call runs on the executor,
+         and the coroutine is resumed on the same executor thread once the call completes.
+         The call blocks its executor thread, but no thread is held by the coroutine while it is not awaiting a call.
+        */
+        template <typename Executor, typename Work>
+        class Operation {
+
+        public:
+            using Result = std::invoke_result_t<Work&>;
+
+            Operation (Executor& executor, Work work) : executor(executor), work(std::move(work)) { }
+
+            bool await_ready () const noexcept { return false; }
+
+            void await_suspend (std::coroutine_handle<> continuation) {
+                executor.Post([this, continuation] {
+                    try {
+                        result.emplace(work());
+                    } catch (...) {
+                        error = std::current_exception();
+                    }
+                    continuation.resume();
+                });
+            }
+
+            Result await_resume () {
+                if (error)
+                    std::rethrow_exception(error);
+                return std::move(*result);
+            }
+
+        private:
+            Executor& executor;
+            Work work;
+            std::optional<Result> result;
+            std::exception_ptr error;
+        };
+
+        template <typename Executor, typename Work>
+        Operation<Executor, Work> MakeOperation (Executor& executor, Work work) {
+            return Operation<Executor, Work>(executor, std::move(work));
+        }
+    }
+
+    /*!
+     @function PredictAsync
+
+     @abstract Create a prediction without blocking the awaiting coroutine.
+
+     @discussion `co_await PredictAsync(predictor, inputs, executor)` resumes on the executor with the prediction.
+     The predictor and inputs MUST remain valid until the coroutine resumes.
+    */
+    template <typename Executor>
+    auto PredictAsync (const Predictor& predictor, const ValueMap& inputs, Executor& executor) {
+        return Detail::MakeOperation(executor, [&predictor, &inputs] { return predictor.Predict(inputs); });
+    }
+
+    /*!
+     @function StreamAsync
+
+     @abstract Create a streaming prediction without blocking the awaiting coroutine.
+
+     @discussion The predictor and inputs MUST remain valid until the coroutine resumes.
+    */
+    template <typename Executor>
+    auto StreamAsync (const Predictor& predictor, const ValueMap& inputs, Executor& executor) {
+        return Detail::MakeOperation(executor, [&predictor, &inputs] { return predictor.Stream(inputs); });
+    }
+
+    /*!
+     @function ReadNextAsync
+
+     @abstract Read the next prediction in a stream without blocking the awaiting coroutine.
+
+     @discussion C++20 does not provide `for co_await`, so streams are consumed with
+     `while (co_await ReadNextAsync(stream, prediction, executor)) { ... }`.
+     The stream and prediction MUST remain valid until the coroutine resumes.
+
+     @returns Awaitable resulting in whether a prediction was read, or `false` if the stream has no more predictions.
+    */
+    template <typename Executor>
+    auto ReadNextAsync (PredictionStream& stream, Prediction& prediction, Executor& executor) {
+        return Detail::MakeOperation(executor, [&stream, &prediction] { return stream.ReadNext(prediction); });
+    }
+}
+
+#endif
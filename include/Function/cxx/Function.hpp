@@ -0,0 +1,22 @@
+//
+//  Function.hpp
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#pragma once
+
+#include <Function/Function.h>
+#include <Function/cxx/Status.hpp>
+#include <Function/cxx/Value.hpp>
+#include <Function/cxx/Tensor.hpp>
+#include <Function/cxx/ValueMap.hpp>
+#include <Function/cxx/Configuration.hpp>
+#include <Function/cxx/Prediction.hpp>
+#include <Function/cxx/PredictionStream.hpp>
+#include <Function/cxx/Predictor.hpp>
+#include <Function/cxx/Batcher.hpp>
+#include <Function/cxx/BoundPrediction.hpp>
+#include <Function/cxx/Coroutine.hpp>
@@ -0,0 +1,78 @@
+//
+//  Prediction.hpp
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#pragma once
+
+#include <Function/FXNPrediction.h>
+#include <Function/cxx/ValueMap.hpp>
+
+namespace Function {
+
+    /*!
+     @class Prediction
+
+     @abstract Prediction.
+    */
+    class Prediction : public Detail::Handle<FXNPrediction, FXNPredictionRelease> {
+
+    public:
+        using Handle::Handle;
+
+        /*!
+         @abstract Copy the prediction ID into a destination buffer.
+        */
+        void GetID (char* destination, int32_t size) const {
+            Detail::Check(FXNPredictionGetID(handle, destination, size), "Failed to get prediction ID");
+        }
+
+        /*!
+         @abstract Get the prediction latency in milliseconds.
+        */
+        double GetLatency () const {
+            double latency = 0;
+            Detail::Check(FXNPredictionGetLatency(handle, &latency), "Failed to get prediction latency");
+            return latency;
+        }
+
+        /*!
+         @abstract Get the prediction results.
+
+         @discussion The returned value map is owned by the prediction.
+        */
+        ValueMap GetResults () const {
+            FXNValueMap* map = nullptr;
+            Detail::Check(FXNPredictionGetResults(handle, &map), "Failed to get prediction results");
+            return ValueMap(map, false);
+        }
+
+        /*!
+         @abstract Copy the prediction error into a destination buffer.
+
+         @returns Whether the prediction has an error.
+        */
+        bool GetError (char* error, int32_t size) const noexcept {
+            return FXNPredictionGetError(handle, error, size) == FXN_OK;
+        }
+
+        /*!
+         @abstract Get the prediction log length.
+        */
+        int32_t GetLogLength () const {
+            int32_t length = 0;
+            Detail::Check(FXNPredictionGetLogLength(handle, &length), "Failed to get prediction log length");
+            return length;
+        }
+
+        /*!
+         @abstract Copy the prediction logs into a destination buffer.
+        */
+        void GetLogs (char* logs, int32_t size) const {
+            Detail::Check(FXNPredictionGetLogs(handle, logs, size), "Failed to get prediction logs");
+        }
+    };
+}
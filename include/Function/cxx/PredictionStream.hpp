@@ -0,0 +1,103 @@
+//
+//  PredictionStream.hpp
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <Function/FXNPredictionStream.h>
+#include <Function/cxx/Prediction.hpp>
+
+namespace Function {
+
+    /*!
+     @class PredictionStream
+
+     @abstract Prediction stream.
+
+     @discussion Prediction streams are single-pass ranges:
+     `for (auto& prediction : stream)` reads each prediction as it becomes available.
+    */
+    class PredictionStream : public Detail::Handle<FXNPredictionStream, FXNPredictionStreamRelease> {
+
+    public:
+        using Handle::Handle;
+
+        /*!
+         @class Iterator
+
+         @abstract Iterator used by range-based for loops over a prediction stream.
+
+         @discussion The iterator owns the current prediction, so it is move-only
+         and does not satisfy the standard iterator requirements.
+        */
+        class Iterator {
+
+        public:
+            using value_type = Prediction;
+            using difference_type = std::ptrdiff_t;
+            using pointer = Prediction*;
+            using reference = Prediction&;
+
+            Iterator () noexcept = default;
+            explicit Iterator (PredictionStream* stream) : stream(stream) { ++*this; }
+
+            Prediction& operator* () noexcept { return current; }
+            Prediction* operator-> () noexcept { return &current; }
+
+            Iterator& operator++ () {
+                if (!stream->ReadNext(current))
+                    stream = nullptr;
+                return *this;
+            }
+
+            bool operator== (const Iterator& other) const noexcept { return stream == other.stream; }
+            bool operator!= (const Iterator& other) const noexcept { return stream != other.stream; }
+
+        private:
+            PredictionStream* stream = nullptr;
+            Prediction current;
+        };
+
+        /*!
+         @abstract Read the next prediction in the stream.
+
+         @param prediction
+         Destination prediction. Any prediction it previously held is released.
+
+         @returns Whether a prediction was read, or `false` if the stream has no more predictions.
+        */
+        bool ReadNext (Prediction& prediction) {
+            FXNPrediction* next = nullptr;
+            auto status = FXNPredictionStreamReadNext(handle, &next);
+            if (status == FXN_ERROR_INVALID_OPERATION)
+                return false;
+            Detail::Check(status, "Failed to read next prediction in stream");
+            prediction = Prediction(next);
+            return true;
+        }
+
+#ifdef FXN_MOCK
+        /*!
+         @abstract Write additional inputs into a duplex prediction stream.
+        */
+        void WriteInputs (const ValueMap& inputs) {
+            Detail::Check(FXNPredictionStreamWriteInputs(handle, inputs), "Failed to write prediction stream inputs");
+        }
+
+        /*!
+         @abstract Signal that no more inputs will be written into a duplex prediction stream.
+        */
+        void CloseInputs () {
+            Detail::Check(FXNPredictionStreamCloseInputs(handle), "Failed to close prediction stream inputs");
+        }
+#endif
+
+        Iterator begin () { return Iterator(this); }
+        Iterator end () noexcept { return Iterator(); }
+    };
+}
@@ -0,0 +1,77 @@
+//
+//  Predictor.hpp
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#pragma once
+
+#include <Function/FXNPredictor.h>
+#include <Function/cxx/Configuration.hpp>
+#include <Function/cxx/Prediction.hpp>
+#include <Function/cxx/PredictionStream.hpp>
+
+namespace Function {
+
+    /*!
+     @class Predictor
+
+     @abstract Predictor.
+    */
+    class Predictor : public Detail::Handle<FXNPredictor, FXNPredictorRelease> {
+
+    public:
+        using Handle::Handle;
+
+        /*!
+         @abstract Create a predictor.
+        */
+        static Predictor Create (const Configuration& configuration) {
+            FXNPredictor* predictor = nullptr;
+            Detail::Check(FXNPredictorCreate(configuration, &predictor), "Failed to create predictor");
+            return Predictor(predictor);
+        }
+
+        /*!
+         @abstract Create a prediction.
+        */
+        Prediction Predict (const ValueMap& inputs) const {
+            FXNPrediction* prediction = nullptr;
+            Detail::Check(FXNPredictorCreatePrediction(handle, inputs, &prediction), "Failed to create prediction");
+            return Prediction(prediction);
+        }
+
+#ifdef FXN_MOCK
+        /*!
+         @abstract Validate and convert prediction inputs once for repeated predictions.
+        */
+        ValueMap PrepareInputs (const ValueMap& inputs) const {
+            FXNValueMap* prepared = nullptr;
+            Detail::Check(FXNPredictorPrepareInputs(handle, inputs, &prepared), "Failed to prepare prediction inputs");
+            return ValueMap(prepared);
+        }
+#endif
+
+        /*!
+         @abstract Create a streaming prediction.
+        */
+        PredictionStream Stream (const ValueMap& inputs) const {
+            FXNPredictionStream* stream = nullptr;
+            Detail::Check(FXNPredictorStreamPrediction(handle, inputs, &stream), "Failed to create prediction stream");
+            return PredictionStream(stream);
+        }
+
+#ifdef FXN_MOCK
+        /*!
+         @abstract Create a streaming prediction which accepts additional inputs while it runs.
+        */
+        PredictionStream CreateDuplexStream (const ValueMap& inputs) const {
+            FXNPredictionStream* stream = nullptr;
+            Detail::Check(FXNPredictorCreateDuplexStream(handle, inputs, &stream), "Failed to create duplex prediction stream");
+            return PredictionStream(stream);
+        }
+#endif
+    };
+}
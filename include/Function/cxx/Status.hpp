@@ -0,0 +1,108 @@
+//
+//  Status.hpp
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#pragma once
+
+#include <stdexcept>
+#include <utility>
+#include <Function/FXNStatus.h>
+
+namespace Function {
+
+    /*!
+     @class Exception
+
+     @abstract Exception thrown when a Function C API call fails.
+    */
+    class Exception : public std::runtime_error {
+
+    public:
+        Exception (FXNStatus status, const char* message) : std::runtime_error(message), status(status) { }
+
+        /*!
+         @abstract Get the status returned by the failing C API call.
+        */
+        FXNStatus GetStatus () const noexcept { return status; }
+
+    private:
+        FXNStatus status;
+    };
+
+    namespace Detail {
+
+        inline void Check (FXNStatus status, const char* message) {
+            if (status != FXN_OK)
+                throw Exception(status, message);
+        }
+
+        /*!
+         @class Handle
+
+         @abstract Move-only owner of an opaque Function C API object.
+
+         @discussion A handle either owns its object, in which case the object is released with `Release`
+         when the handle is destroyed, or borrows it from another object which owns it.
+        */
+        template <typename T, FXNStatus (*Release)(T*)>
+        class Handle {
+
+        public:
+            Handle () noexcept = default;
+            explicit Handle (T* handle, bool owner = true) noexcept : handle(handle), owner(owner) { }
+            Handle (Handle&& other) noexcept : handle(std::exchange(other.handle, nullptr)), owner(std::exchange(other.owner, false)) { }
+            Handle (const Handle&) = delete;
+            ~Handle () { Reset(); }
+
+            Handle& operator= (Handle&& other) noexcept {
+                if (this != &other) {
+                    Reset();
+                    handle = std::exchange(other.handle, nullptr);
+                    owner = std::exchange(other.owner, false);
+                }
+                return *this;
+            }
+            Handle& operator= (const Handle&) = delete;
+
+            /*!
+             @abstract Get the underlying C API object.
+            */
+            operator T* () const noexcept { return handle; }
+
+            /*!
+             @abstract Whether the handle refers to an object.
+            */
+            explicit operator bool () const noexcept { return handle != nullptr; }
+
+            /*!
+             @abstract Whether the handle owns its object.
+            */
+            bool IsOwner () const noexcept { return owner; }
+
+            /*!
+             @abstract Relinquish ownership of the underlying C API object.
+
+             @discussion The caller becomes responsible for releasing the returned object.
+            */
+            T* Detach () noexcept {
+                owner = false;
+                return std::exchange(handle, nullptr);
+            }
+
+        protected:
+            void Reset () noexcept {
+                if (handle && owner)
+                    Release(handle);
+                handle = nullptr;
+                owner = false;
+            }
+
+            T* handle = nullptr;
+            bool owner = false;
+        };
+    }
+}
@@ -0,0 +1,78 @@
+//
+//  Tensor.hpp
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <Function/cxx/Value.hpp>
+
+namespace Function {
+
+    /*!
+     @class Tensor
+
+     @abstract Non-owning, statically typed view over the data of a tensor value.
+
+     @discussion A `TensorView` whose rank is checked once when the tensor is created,
+     following the same element type rules as `Value::GetTensor`.
+     Element access afterwards is unchecked and branch-free, so loops over a tensor can be vectorized.
+     The tensor is only valid for the lifetime of the value it was created from.
+    */
+    template <typename T, std::size_t Rank>
+    class Tensor : public TensorView<T> {
+
+    public:
+        /*!
+         @abstract Create a tensor over the data of a value.
+
+         @discussion Throws a `Function::Exception` if the value data type or rank does not match.
+        */
+        explicit Tensor (const Value& value) : TensorView<T>(value.GetTensor<T>()) {
+            const auto& shape = this->GetShape();
+            if (shape.GetDimensions() != static_cast<int32_t>(Rank))
+                throw Exception(FXN_ERROR_INVALID_OPERATION, "Value rank does not match tensor rank");
+            std::size_t stride = 1;
+            for (std::size_t i = Rank; i-- > 0;) {
+                extents[i] = static_cast<std::size_t>(shape[static_cast<int32_t>(i)]);
+                strides[i] = stride;
+                stride *= extents[i];
+            }
+        }
+
+        /*!
+         @abstract Get the extent of a given dimension.
+        */
+        std::size_t extent (std::size_t dimension) const noexcept { return extents[dimension]; }
+
+        /*!
+         @abstract Get the element stride of a given dimension.
+        */
+        std::size_t stride (std::size_t dimension) const noexcept { return strides[dimension]; }
+
+        /*!
+         @abstract Access an element by its row-major multi-dimensional index.
+        */
+        template <typename... Indices>
+        T& operator() (Indices... indices) const noexcept {
+            static_assert(sizeof...(Indices) == Rank, "Tensor index count must match tensor rank");
+            const std::size_t index[] = { 0, static_cast<std::size_t>(indices)... };
+            std::size_t offset = 0;
+            for (std::size_t i = 0; i < Rank; ++i)
+                offset += index[i + 1] * strides[i];
+            return this->data()[offset];
+        }
+
+        static constexpr std::size_t rank () noexcept { return Rank; }
+
+    private:
+        std::array<std::size_t, Rank> extents = { };
+        std::array<std::size_t, Rank> strides = { };
+    };
+}
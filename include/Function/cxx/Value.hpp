@@ -0,0 +1,389 @@
+//
+//  Value.hpp
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <Function/FXNValue.h>
+#include <Function/cxx/Status.hpp>
+
+namespace Function {
+
+    /*!
+     @function GetElementSize
+
+     @abstract Get the size in bytes of a single tensor element of a given data type.
+
+     @returns Element size, or zero if the data type is not a tensor type.
+    */
+    constexpr std::size_t GetElementSize (FXNDtype dtype) noexcept {
+        switch (dtype) {
+            case FXN_DTYPE_INT8:
+            case FXN_DTYPE_UINT8:
+            case FXN_DTYPE_BOOL:
+            case FXN_DTYPE_IMAGE:
+            case FXN_DTYPE_BINARY:      return 1;
+            case FXN_DTYPE_FLOAT16:
+            case FXN_DTYPE_INT16:
+            case FXN_DTYPE_UINT16:      return 2;
+            case FXN_DTYPE_FLOAT32:
+            case FXN_DTYPE_INT32:
+            case FXN_DTYPE_UINT32:      return 4;
+            case FXN_DTYPE_FLOAT64:
+            case FXN_DTYPE_INT64:
+            case FXN_DTYPE_UINT64:      return 8;
+            default:                    return 0;
+        }
+    }
+
+    /*!
+     @struct Float16
+
+     @abstract IEEE 754 half precision 16-bit float storage.
+    */
+    struct Float16 {
+        uint16_t bits;
+    };
+
+    /*!
+     @struct Dtype
+
+     @abstract Map a C++ tensor element type to its Function data type at compile time.
+    */
+    template <typename T> struct Dtype;
+    template <> struct Dtype<Float16>   : std::integral_constant<FXNDtype, FXN_DTYPE_FLOAT16> { };
+    template <> struct Dtype<float>     : std::integral_constant<FXNDtype, FXN_DTYPE_FLOAT32> { };
+    template <> struct Dtype<double>    : std::integral_constant<FXNDtype, FXN_DTYPE_FLOAT64> { };
+    template <> struct Dtype<int8_t>    : std::integral_constant<FXNDtype, FXN_DTYPE_INT8> { };
+    template <> struct Dtype<int16_t>   : std::integral_constant<FXNDtype, FXN_DTYPE_INT16> { };
+    template <> struct Dtype<int32_t>   : std::integral_constant<FXNDtype, FXN_DTYPE_INT32> { };
+    template <> struct Dtype<int64_t>   : std::integral_constant<FXNDtype, FXN_DTYPE_INT64> { };
+    template <> struct Dtype<uint8_t>   : std::integral_constant<FXNDtype, FXN_DTYPE_UINT8> { };
+    template <> struct Dtype<uint16_t>  : std::integral_constant<FXNDtype, FXN_DTYPE_UINT16> { };
+    template <> struct Dtype<uint32_t>  : std::integral_constant<FXNDtype, FXN_DTYPE_UINT32> { };
+    template <> struct Dtype<uint64_t>  : std::integral_constant<FXNDtype, FXN_DTYPE_UINT64> { };
+    template <> struct Dtype<bool>      : std::integral_constant<FXNDtype, FXN_DTYPE_BOOL> { };
+
+    /*!
+     @class Shape
+
+     @abstract Tensor shape.
+
+     @discussion Shapes with up to `InlineDimensions` dimensions are stored inline without allocating.
+    */
+    class Shape {
+
+    public:
+        static constexpr int32_t InlineDimensions = 8;
+
+        Shape () noexcept = default;
+
+        Shape (const int32_t* shape, int32_t dims) : dims(dims) {
+            std::copy_n(shape, dims, Allocate());
+        }
+
+        Shape (const Shape& other) : Shape(other.data(), other.dims) { }
+
+        Shape (Shape&& other) noexcept : dims(other.dims), heap(std::move(other.heap)) {
+            std::copy_n(other.storage, InlineDimensions, storage);
+            other.dims = 0;
+        }
+
+        Shape& operator= (Shape other) noexcept {
+            dims = other.dims;
+            heap = std::move(other.heap);
+            std::copy_n(other.storage, InlineDimensions, storage);
+            return *this;
+        }
+
+        /*!
+         @abstract Get the number of dimensions.
+        */
+        int32_t GetDimensions () const noexcept { return dims; }
+
+        /*!
+         @abstract Get the number of elements described by the shape.
+        */
+        std::size_t GetElementCount () const noexcept {
+            std::size_t count = 1;
+            for (int32_t i = 0; i < dims; ++i)
+                count *= static_cast<std::size_t>(data()[i]);
+            return count;
+        }
+
+        int32_t operator[] (int32_t index) const noexcept { return data()[index]; }
+        const int32_t* data () const noexcept { return heap ? heap.get() : storage; }
+        std::size_t size () const noexcept { return static_cast<std::size_t>(dims); }
+        const int32_t* begin () const noexcept { return data(); }
+        const int32_t* end () const noexcept { return data() + dims; }
+
+    private:
+        friend class Value;
+
+        int32_t* Allocate () {
+            if (dims > InlineDimensions)
+                heap.reset(new int32_t[dims]);
+            return heap ? heap.get() : storage;
+        }
+
+        int32_t dims = 0;
+        int32_t storage[InlineDimensions] = { };
+        std::unique_ptr<int32_t[]> heap;
+    };
+
+    /*!
+     @class TensorView
+
+     @abstract Non-owning view over the data of a tensor value.
+
+     @discussion The view exposes a `std::span`-compatible interface and is only valid
+     for the lifetime of the value it was created from. Element access is unchecked.
+    */
+    template <typename T>
+    class TensorView {
+
+    public:
+        using element_type = T;
+        using value_type = std::remove_cv_t<T>;
+        using size_type = std::size_t;
+        using pointer = T*;
+        using reference = T&;
+        using iterator = T*;
+
+        TensorView () noexcept = default;
+        TensorView (T* data, Shape shape) noexcept : ptr(data), count(shape.GetElementCount()), shape(std::move(shape)) { }
+
+        /*!
+         @abstract Get the tensor shape.
+        */
+        const Shape& GetShape () const noexcept { return shape; }
+
+        /*!
+         @abstract Access an element by its row-major multi-dimensional index.
+
+         @discussion Throws a `Function::Exception` if the number of indices does not match the tensor rank.
+         The indices themselves are not checked.
+        */
+        template <typename... Indices>
+        T& operator() (Indices... indices) const {
+            if (sizeof...(Indices) != shape.size())
+                throw Exception(FXN_ERROR_INVALID_ARGUMENT, "Tensor index count must match tensor rank");
+            const std::size_t index[] = { static_cast<std::size_t>(indices)... };
+            std::size_t offset = 0;
+            for (std::size_t i = 0; i < sizeof...(Indices); ++i)
+                offset = offset * static_cast<std::size_t>(shape[static_cast<int32_t>(i)]) + index[i];
+            return ptr[offset];
+        }
+
+        T& operator[] (std::size_t index) const noexcept { return ptr[index]; }
+        T* data () const noexcept { return ptr; }
+        std::size_t size () const noexcept { return count; }
+        bool empty () const noexcept { return count == 0; }
+        T* begin () const noexcept { return ptr; }
+        T* end () const noexcept { return ptr + count; }
+
+    private:
+        T* ptr = nullptr;
+        std::size_t count = 0;
+        Shape shape;
+    };
+
+    /*!
+     @class Value
+
+     @abstract Prediction input or output value.
+    */
+    class Value : public Detail::Handle<FXNValue, FXNValueRelease> {
+
+    public:
+        using Handle::Handle;
+
+        /*!
+         @abstract Get the value data type.
+        */
+        FXNDtype GetType () const {
+            FXNDtype type = FXN_DTYPE_NULL;
+            Detail::Check(FXNValueGetType(handle, &type), "Failed to get value type");
+            return type;
+        }
+
+        /*!
+         @abstract Get an opaque pointer to the value data.
+        */
+        void* GetData () const {
+            void* data = nullptr;
+            Detail::Check(FXNValueGetData(handle, &data), "Failed to get value data");
+            return data;
+        }
+
+        /*!
+         @abstract Get the value shape.
+        */
+        Shape GetShape () const {
+            Shape shape;
+            Detail::Check(FXNValueGetDimensions(handle, &shape.dims), "Failed to get value dimensions");
+            Detail::Check(FXNValueGetShape(handle, shape.Allocate(), shape.dims), "Failed to get value shape");
+            return shape;
+        }
+
+        /*!
+         @abstract Get a non-owning view over the tensor data.
+
+         @discussion The element type `T` is checked against the value data type.
+         `uint8_t` views can also be created over image and binary values.
+         For compile-time rank checking, use `Function::Tensor` instead.
+        */
+        template <typename T>
+        TensorView<T> GetTensor () const {
+            using Element = std::remove_cv_t<T>;
+            const auto type = GetType();
+            const bool bytes = std::is_same_v<Element, uint8_t> && (type == FXN_DTYPE_IMAGE || type == FXN_DTYPE_BINARY);
+            if (Dtype<Element>::value != type && !bytes)
+                throw Exception(FXN_ERROR_INVALID_OPERATION, "Value element type does not match tensor element type");
+            return TensorView<T>(static_cast<T*>(GetData()), GetShape());
+        }
+
+#ifdef FXN_MOCK
+        /*!
+         @abstract Get the number of items in a list value.
+        */
+        int32_t GetListLength () const {
+            int32_t length = 0;
+            Detail::Check(FXNValueGetListLength(handle, &length), "Failed to get list length");
+            return length;
+        }
+
+        /*!
+         @abstract Get an item of a list value.
+
+         @discussion The returned value is owned by the list.
+        */
+        Value GetListItem (int32_t index) const {
+            FXNValue* item = nullptr;
+            Detail::Check(FXNValueGetListItem(handle, index, &item), "Failed to get list item");
+            return Value(item, false);
+        }
+
+        /*!
+         @abstract Copy the name of the shared memory region containing the value data into a destination buffer.
+        */
+        void GetSharedMemoryName (char* name, int32_t size) const {
+            Detail::Check(FXNValueGetSharedMemoryName(handle, name, size), "Failed to get value shared memory name");
+        }
+#endif
+
+        /*!
+         @abstract Create an array value from a data buffer.
+        */
+        static Value CreateArray (
+            void* data,
+            const int32_t* shape,
+            int32_t dims,
+            FXNDtype dtype,
+            FXNValueFlags flags = FXN_VALUE_FLAG_NONE
+        ) {
+            FXNValue* value = nullptr;
+            Detail::Check(FXNValueCreateArray(data, shape, dims, dtype, flags, &value), "Failed to create array value");
+            return Value(value);
+        }
+
+        /*!
+         @abstract Create a string value from a UTF-8 encoded string.
+        */
+        static Value CreateString (const char* data) {
+            FXNValue* value = nullptr;
+            Detail::Check(FXNValueCreateString(data, &value), "Failed to create string value");
+            return Value(value);
+        }
+
+        /*!
+         @abstract Create a list value from a JSON-encoded list.
+        */
+        static Value CreateList (const char* data) {
+            FXNValue* value = nullptr;
+            Detail::Check(FXNValueCreateList(data, &value), "Failed to create list value");
+            return Value(value);
+        }
+
+#ifdef FXN_MOCK
+        /*!
+         @abstract Create a list value from a sequence of values without JSON encoding.
+
+         @discussion The list takes ownership of the items.
+         Borrowed values MUST NOT be inserted into a list.
+        */
+        static Value CreateListFromValues (Value* items, int32_t count) {
+            std::unique_ptr<FXNValue*[]> handles(new FXNValue*[count > 0 ? count : 1]);
+            for (int32_t i = 0; i < count; ++i)
+                handles[i] = items[i];
+            FXNValue* value = nullptr;
+            Detail::Check(FXNValueCreateListFromValues(handles.get(), count, &value), "Failed to create list value");
+            for (int32_t i = 0; i < count; ++i)
+                items[i].Detach();
+            return Value(value);
+        }
+#endif
+
+        /*!
+         @abstract Create a dictionary value from a JSON-encoded dictionary.
+        */
+        static Value CreateDict (const char* data) {
+            FXNValue* value = nullptr;
+            Detail::Check(FXNValueCreateDict(data, &value), "Failed to create dictionary value");
+            return Value(value);
+        }
+
+        /*!
+         @abstract Create an image value from a pixel buffer.
+        */
+        static Value CreateImage (
+            const uint8_t* pixelBuffer,
+            int32_t width,
+            int32_t height,
+            int32_t channels,
+            FXNValueFlags flags = FXN_VALUE_FLAG_NONE
+        ) {
+            FXNValue* value = nullptr;
+            Detail::Check(FXNValueCreateImage(pixelBuffer, width, height, channels, flags, &value), "Failed to create image value");
+            return Value(value);
+        }
+
+        /*!
+         @abstract Create a binary value from a raw buffer.
+        */
+        static Value CreateBinary (void* buffer, int32_t bufferLen, FXNValueFlags flags = FXN_VALUE_FLAG_NONE) {
+            FXNValue* value = nullptr;
+            Detail::Check(FXNValueCreateBinary(buffer, bufferLen, flags, &value), "Failed to create binary value");
+            return Value(value);
+        }
+
+#ifdef FXN_MOCK
+        /*!
+         @abstract Create an array value backed by a named shared memory region.
+        */
+        static Value CreateFromSharedMemory (const char* name, const int32_t* shape, int32_t dims, FXNDtype dtype) {
+            FXNValue* value = nullptr;
+            Detail::Check(FXNValueCreateFromSharedMemory(name, shape, dims, dtype, &value), "Failed to create shared memory value");
+            return Value(value);
+        }
+#endif
+
+        /*!
+         @abstract Create a null value.
+        */
+        static Value CreateNull () {
+            FXNValue* value = nullptr;
+            Detail::Check(FXNValueCreateNull(&value), "Failed to create null value");
+            return Value(value);
+        }
+    };
+}
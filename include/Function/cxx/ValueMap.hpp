@@ -0,0 +1,106 @@
+//
+//  ValueMap.hpp
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#pragma once
+
+#include <Function/FXNValueMap.h>
+#include <Function/cxx/Value.hpp>
+
+namespace Function {
+
+    /*!
+     @class ValueMap
+
+     @abstract Prediction value map.
+    */
+    class ValueMap : public Detail::Handle<FXNValueMap, FXNValueMapRelease> {
+
+    public:
+        using Handle::Handle;
+
+        /*!
+         @abstract Create an empty value map.
+        */
+        static ValueMap Create () {
+            FXNValueMap* map = nullptr;
+            Detail::Check(FXNValueMapCreate(&map), "Failed to create value map");
+            return ValueMap(map);
+        }
+
+        /*!
+         @abstract Get the number of values in the map.
+        */
+        int32_t GetSize () const {
+            int32_t size = 0;
+            Detail::Check(FXNValueMapGetSize(handle, &size), "Failed to get value map size");
+            return size;
+        }
+
+        /*!
+         @abstract Copy the key at a given index into a destination buffer.
+        */
+        void GetKey (int32_t index, char* key, int32_t size) const {
+            Detail::Check(FXNValueMapGetKey(handle, index, key, size), "Failed to get value map key");
+        }
+
+        /*!
+         @abstract Get the value for a given key.
+
+         @discussion The returned value is owned by the map.
+
+         @returns The value, or an empty value if the map does not contain the key.
+        */
+        Value Get (const char* key) const noexcept {
+            FXNValue* value = nullptr;
+            return FXNValueMapGetValue(handle, key, &value) == FXN_OK ? Value(value, false) : Value();
+        }
+
+        /*!
+         @abstract Set the value for a given key.
+
+         @discussion The map takes ownership of an owned value.
+         Borrowed values MUST NOT be inserted into another map.
+        */
+        void Set (const char* key, Value&& value) {
+            Detail::Check(FXNValueMapSetValue(handle, key, value), "Failed to set value map value");
+            value.Detach();
+        }
+
+        /*!
+         @abstract Remove the value for a given key if present.
+        */
+        void Remove (const char* key) {
+            Detail::Check(FXNValueMapSetValue(handle, key, nullptr), "Failed to remove value map value");
+        }
+
+#ifdef FXN_MOCK
+        /*!
+         @abstract Create a dictionary value from a value map without JSON encoding.
+
+         @discussion The dictionary takes ownership of the value map.
+        */
+        static Value CreateDict (ValueMap&& map) {
+            FXNValue* value = nullptr;
+            Detail::Check(FXNValueCreateDictFromValueMap(map, &value), "Failed to create dictionary value");
+            map.Detach();
+            return Value(value);
+        }
+
+        /*!
+         @abstract Get the entries of a dictionary value.
+
+         @discussion The returned value map is owned by the dictionary.
+        */
+        static ValueMap GetDict (const Value& value) {
+            FXNValueMap* map = nullptr;
+            Detail::Check(FXNValueGetDictValueMap(value, &map), "Failed to get dictionary entries");
+            return ValueMap(map, false);
+        }
+#endif
+    };
+}
@@ -0,0 +1,300 @@
+//
+//  FXNBatcher.c
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "FXNMock.h"
+
+// Darwin has no `pthread_condattr_setclock`, so its condition variables wait on the realtime clock
+#if defined(__APPLE__)
+#define FXN_BATCHER_CLOCK CLOCK_REALTIME
+#else
+#define FXN_BATCHER_CLOCK CLOCK_MONOTONIC
+#endif
+
+/*!
+ Requests are queued by the calling threads, which block until a worker thread has executed them.
+ The worker collects requests until the batch is full or the oldest request has waited for `maxDelay`,
+ then stacks the `a` rows of matmul requests into a single matrix and runs the model once.
+ Requests to other predictors, or with invalid inputs, are executed individually.
+*/
+struct FXNBatcherRequest {
+    FXNValueMap* inputs;
+    FXNPrediction* prediction;
+    FXNStatus status;
+    bool done;
+    double start;
+    struct timespec deadline;
+    struct FXNBatcherRequest* next;
+};
+
+struct FXNBatcher {
+    FXNPredictor* predictor;
+    int32_t maxBatchSize;
+    int32_t maxDelay;
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t pending;
+    pthread_cond_t completed;
+    struct FXNBatcherRequest* head;
+    struct FXNBatcherRequest* tail;
+    struct FXNBatcherRequest** batch;
+    int32_t count;
+    int32_t callers;
+    bool closed;
+};
+
+static void FXNBatcherExecuteRequest (FXNPredictor* predictor, struct FXNBatcherRequest* request) {
+    request->status = FXNPredictorCreatePrediction(predictor, request->inputs, &request->prediction);
+    if (request->status == FXN_OK)
+        request->prediction->latency = FXNMockGetTime() - request->start;
+}
+
+static FXNStatus FXNBatcherExecuteMatmul (
+    FXNPredictor* predictor,
+    struct FXNMockModel* model,
+    struct FXNBatcherRequest** requests,
+    FXNValue** rows,
+    int32_t count
+) {
+    // Stack rows
+    int64_t total = 0;
+    for (int32_t i = 0; i < count; ++i)
+        total += rows[i]->shape[0];
+    const size_t stride = sizeof(float) * (size_t)model->size;
+    float* lhs = malloc(stride * (size_t)(total > 0 ? total : 1));
+    float* out = malloc(stride * (size_t)(total > 0 ? total : 1));
+    FXNStatus status = lhs && out ? FXNMockMakeResident(predictor, model) : FXN_ERROR_INVALID_OPERATION;
+    if (status != FXN_OK) {
+        free(lhs);
+        free(out);
+        return status;
+    }
+    for (int32_t i = 0, offset = 0; i < count; offset += rows[i]->shape[0], ++i)
+        memcpy(lhs + (size_t)offset * (size_t)model->size, rows[i]->data, stride * (size_t)rows[i]->shape[0]);
+    // Run once for the whole batch
+    const double start = FXNMockGetTime();
+    FXNMockMatmul(predictor, model, lhs, out, total);
+    const double end = FXNMockGetTime();
+    const double latency = end - start;
+    free(lhs);
+    // Split results
+    for (int32_t i = 0, offset = 0; i < count; offset += rows[i]->shape[0], ++i) {
+        struct FXNBatcherRequest* request = requests[i];
+        FXNValueMap* results = NULL;
+        FXNValue* c = NULL;
+        request->status = FXNValueMapCreate(&results);
+        if (request->status == FXN_OK)
+            request->status = FXNValueCreateArray(
+                out + (size_t)offset * (size_t)model->size,
+                rows[i]->shape,
+                2,
+                FXN_DTYPE_FLOAT32,
+                FXN_VALUE_FLAG_COPY_DATA,
+                &c
+            );
+        if (request->status == FXN_OK)
+            request->status = FXNValueMapSetValue(results, "c", c);
+        if (request->status == FXN_OK)
+            c = NULL;
+        if (c)
+            FXNValueRelease(c);
+        if (request->status == FXN_OK && predictor->sharedMemoryOutputs)
+            request->status = FXNMockShareValueMap(results);
+        if (request->status == FXN_OK)
+            request->status = FXNMockCreatePrediction(results, end - request->start, &request->prediction);
+        if (request->status != FXN_OK) {
+            if (results)
+                FXNValueMapRelease(results);
+            continue;
+        }
+        if (predictor->recorder)
+            FXNMockRecordPrediction(predictor->recorder, request->inputs, request->start, latency);
+    }
+    free(out);
+    return FXN_OK;
+}
+
+static void FXNBatcherExecute (FXNBatcher* batcher, struct FXNBatcherRequest** requests, int32_t count) {
+    FXNPredictor* predictor = batcher->predictor;
+    struct FXNMockModel* model = FXNMockAcquireModel(predictor);
+    if (model->kind != FXN_MOCK_MATMUL || count == 1) {
+        for (int32_t i = 0; i < count; ++i)
+            FXNBatcherExecuteRequest(predictor, requests[i]);
+        FXNMockReleaseModel(model);
+        return;
+    }
+    // Validate and convert inputs
+    struct FXNBatcherRequest** batch = calloc((size_t)count, sizeof(struct FXNBatcherRequest*));
+    FXNValueMap** converted = calloc((size_t)count, sizeof(FXNValueMap*));
+    FXNValue** rows = calloc((size_t)count, sizeof(FXNValue*));
+    int32_t batchSize = 0;
+    for (int32_t i = 0; batch && converted && rows && i < count; ++i) {
+        const char* error = NULL;
+        FXNValueMap* bound = NULL;
+        FXNStatus status = FXNMockBindInputs(model, requests[i]->inputs, false, &bound, &error);
+        if (status != FXN_OK || error) {
+            FXNBatcherExecuteRequest(predictor, requests[i]);
+            continue;
+        }
+        FXNValueMapGetValue(bound ? bound : requests[i]->inputs, "a", &rows[batchSize]);
+        converted[batchSize] = bound;
+        batch[batchSize++] = requests[i];
+    }
+    // Run batch, falling back to individual predictions on failure
+    if (!batch || !converted || !rows)
+        for (int32_t i = 0; i < count; ++i)
+            FXNBatcherExecuteRequest(predictor, requests[i]);
+    else if (FXNBatcherExecuteMatmul(predictor, model, batch, rows, batchSize) != FXN_OK)
+        for (int32_t i = 0; i < batchSize; ++i)
+            FXNBatcherExecuteRequest(predictor, batch[i]);
+    for (int32_t i = 0; converted && i < batchSize; ++i)
+        if (converted[i])
+            FXNValueMapRelease(converted[i]);
+    free(batch);
+    free(converted);
+    free(rows);
+    FXNMockReleaseModel(model);
+}
+
+static void* FXNBatcherWorker (void* context) {
+    FXNBatcher* batcher = context;
+    pthread_mutex_lock(&batcher->lock);
+    for (;;) {
+        while (!batcher->head && !batcher->closed)
+            pthread_cond_wait(&batcher->pending, &batcher->lock);
+        if (!batcher->head)
+            break;
+        // Wait for the batch to fill up, up to the deadline of the oldest request
+        while (!batcher->closed && batcher->count < batcher->maxBatchSize)
+            if (pthread_cond_timedwait(&batcher->pending, &batcher->lock, &batcher->head->deadline) == ETIMEDOUT)
+                break;
+        int32_t count = 0;
+        for (; batcher->head && count < batcher->maxBatchSize; ++count) {
+            batcher->batch[count] = batcher->head;
+            batcher->head = batcher->head->next;
+            --batcher->count;
+        }
+        if (!batcher->head)
+            batcher->tail = NULL;
+        pthread_mutex_unlock(&batcher->lock);
+        FXNBatcherExecute(batcher, batcher->batch, count);
+        pthread_mutex_lock(&batcher->lock);
+        for (int32_t i = 0; i < count; ++i)
+            batcher->batch[i]->done = true;
+        pthread_cond_broadcast(&batcher->completed);
+    }
+    pthread_mutex_unlock(&batcher->lock);
+    return NULL;
+}
+
+#pragma region --Lifecycle--
+FXNStatus FXNBatcherCreate (
+    FXNPredictor* predictor,
+    int32_t maxBatchSize,
+    int32_t maxDelay,
+    FXNBatcher** batcher
+) {
+    if (!predictor || maxBatchSize <= 0 || maxDelay < 0 || !batcher)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    FXNBatcher* result = calloc(1, sizeof(FXNBatcher));
+    if (!result)
+        return FXN_ERROR_INVALID_OPERATION;
+    result->predictor = predictor;
+    result->maxBatchSize = maxBatchSize;
+    result->maxDelay = maxDelay;
+    result->batch = calloc((size_t)maxBatchSize, sizeof(struct FXNBatcherRequest*));
+    if (!result->batch) {
+        free(result);
+        return FXN_ERROR_INVALID_OPERATION;
+    }
+    pthread_condattr_t attributes;
+    pthread_condattr_init(&attributes);
+#if !defined(__APPLE__)
+    pthread_condattr_setclock(&attributes, FXN_BATCHER_CLOCK);
+#endif
+    pthread_mutex_init(&result->lock, NULL);
+    pthread_cond_init(&result->pending, &attributes);
+    pthread_cond_init(&result->completed, NULL);
+    pthread_condattr_destroy(&attributes);
+    if (pthread_create(&result->thread, NULL, FXNBatcherWorker, result) != 0) {
+        pthread_cond_destroy(&result->completed);
+        pthread_cond_destroy(&result->pending);
+        pthread_mutex_destroy(&result->lock);
+        free(result->batch);
+        free(result);
+        return FXN_ERROR_INVALID_OPERATION;
+    }
+    *batcher = result;
+    return FXN_OK;
+}
+
+FXNStatus FXNBatcherRelease (FXNBatcher* batcher) {
+    if (!batcher)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    // The worker executes pending requests before exiting,
+    // and callers must leave before the lock can be destroyed
+    pthread_mutex_lock(&batcher->lock);
+    batcher->closed = true;
+    pthread_cond_signal(&batcher->pending);
+    while (batcher->callers > 0)
+        pthread_cond_wait(&batcher->completed, &batcher->lock);
+    pthread_mutex_unlock(&batcher->lock);
+    pthread_join(batcher->thread, NULL);
+    pthread_cond_destroy(&batcher->completed);
+    pthread_cond_destroy(&batcher->pending);
+    pthread_mutex_destroy(&batcher->lock);
+    free(batcher->batch);
+    free(batcher);
+    return FXN_OK;
+}
+#pragma endregion
+
+
+#pragma region --Operations--
+FXNStatus FXNBatcherCreatePrediction (
+    FXNBatcher* batcher,
+    FXNValueMap* inputs,
+    FXNPrediction** prediction
+) {
+    if (!batcher || !inputs || !prediction)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    struct FXNBatcherRequest request = { .inputs = inputs, .status = FXN_OK, .start = FXNMockGetTime() };
+    clock_gettime(FXN_BATCHER_CLOCK, &request.deadline);
+    request.deadline.tv_sec += batcher->maxDelay / 1000000;
+    request.deadline.tv_nsec += (long)(batcher->maxDelay % 1000000) * 1000;
+    if (request.deadline.tv_nsec >= 1000000000) {
+        request.deadline.tv_sec += 1;
+        request.deadline.tv_nsec -= 1000000000;
+    }
+    // Enqueue and wait for the batch to execute
+    pthread_mutex_lock(&batcher->lock);
+    if (batcher->closed) {
+        pthread_mutex_unlock(&batcher->lock);
+        return FXN_ERROR_INVALID_OPERATION;
+    }
+    if (batcher->tail)
+        batcher->tail->next = &request;
+    else
+        batcher->head = &request;
+    batcher->tail = &request;
+    ++batcher->count;
+    ++batcher->callers;
+    pthread_cond_signal(&batcher->pending);
+    while (!request.done)
+        pthread_cond_wait(&batcher->completed, &batcher->lock);
+    if (--batcher->callers == 0 && batcher->closed)
+        pthread_cond_broadcast(&batcher->completed);
+    pthread_mutex_unlock(&batcher->lock);
+    if (request.status == FXN_OK)
+        *prediction = request.prediction;
+    return request.status;
+}
+#pragma endregion
@@ -0,0 +1,136 @@
+//
+//  FXNBoundPrediction.c
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include "FXNMock.h"
+
+/*!
+ The bound prediction holds a reference to its model, which keeps the model weights resident.
+ Tensors used by the model kernels are resolved when the prediction is bound.
+*/
+struct FXNBoundPrediction {
+    FXNPredictor* predictor;
+    struct FXNMockModel* model;
+    FXNValueMap* inputs;
+    FXNValueMap* results;
+    FXNValue* input;
+    FXNValue* output;
+};
+
+#pragma region --Lifecycle--
+FXNStatus FXNBoundPredictionCreate (
+    FXNPredictor* predictor,
+    FXNValueMap* inputs,
+    FXNBoundPrediction** prediction
+) {
+    if (!predictor || !inputs || !prediction)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    FXNBoundPrediction* result = calloc(1, sizeof(FXNBoundPrediction));
+    if (!result)
+        return FXN_ERROR_INVALID_OPERATION;
+    result->predictor = predictor;
+    result->model = FXNMockAcquireModel(predictor);
+    // Bind inputs
+    const char* error = NULL;
+    FXNStatus status = FXNMockBindInputs(result->model, inputs, true, &result->inputs, &error);
+    if (status == FXN_OK && error)
+        status = FXN_ERROR_INVALID_ARGUMENT;
+    // Plan results by running once
+    if (status == FXN_OK)
+        status = FXNMockMakeResident(predictor, result->model);
+    if (status == FXN_OK)
+        status = FXNMockRun(predictor, result->model, result->inputs, &result->results, &error);
+    if (status == FXN_OK && error)
+        status = FXN_ERROR_INVALID_ARGUMENT;
+    if (status == FXN_OK && predictor->sharedMemoryOutputs)
+        status = FXNMockShareValueMap(result->results);
+    if (status != FXN_OK) {
+        FXNBoundPredictionRelease(result);
+        return status;
+    }
+    switch (result->model->kind) {
+        case FXN_MOCK_MATMUL:
+            FXNValueMapGetValue(result->inputs, "a", &result->input);
+            FXNValueMapGetValue(result->results, "c", &result->output);
+            break;
+        case FXN_MOCK_TOKENS:
+            FXNValueMapGetValue(result->results, "tokens", &result->output);
+            break;
+        default:
+            break;
+    }
+    *prediction = result;
+    return FXN_OK;
+}
+
+FXNStatus FXNBoundPredictionRelease (FXNBoundPrediction* prediction) {
+    if (!prediction)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    if (prediction->inputs)
+        FXNValueMapRelease(prediction->inputs);
+    if (prediction->results)
+        FXNValueMapRelease(prediction->results);
+    FXNMockReleaseModel(prediction->model);
+    free(prediction);
+    return FXN_OK;
+}
+#pragma endregion
+
+
+#pragma region --Operations--
+FXNStatus FXNBoundPredictionGetInputs (FXNBoundPrediction* prediction, FXNValueMap** inputs) {
+    if (!prediction || !inputs)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    *inputs = prediction->inputs;
+    return FXN_OK;
+}
+
+FXNStatus FXNBoundPredictionGetResults (FXNBoundPrediction* prediction, FXNValueMap** results) {
+    if (!prediction || !results)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    *results = prediction->results;
+    return FXN_OK;
+}
+
+static void FXNBoundPredictionExecute (void* context, int64_t index) {
+    FXNBoundPrediction* prediction = context;
+    struct FXNMockModel* model = prediction->model;
+    switch (model->kind) {
+        case FXN_MOCK_ECHO:
+            // Results are a copy of the inputs, so entries line up
+            for (int32_t i = 0; i < prediction->inputs->size; ++i) {
+                const FXNValue* input = prediction->inputs->entries[i].value;
+                FXNValue* output = prediction->results->entries[i].value;
+                if (input->data && output->data)
+                    memcpy(output->data, input->data, input->size);
+            }
+            break;
+        case FXN_MOCK_SLEEP:
+            FXNMockSleep(model->duration);
+            break;
+        case FXN_MOCK_TOKENS:
+            FXNMockGenerateTokens(model, prediction->output->data);
+            break;
+        default:
+            break;
+    }
+}
+
+FXNStatus FXNBoundPredictionRun (FXNBoundPrediction* prediction) {
+    if (!prediction)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    // Matmul rows run in parallel, while other kernels run as a single unit of work
+    FXNValue* input = prediction->input;
+    if (prediction->model->kind == FXN_MOCK_MATMUL)
+        FXNMockMatmul(prediction->predictor, prediction->model, input->data, prediction->output->data, input->shape[0]);
+    else
+        FXNMockParallelFor(prediction->predictor, 1, FXNBoundPredictionExecute, prediction);
+    return FXN_OK;
+}
+#pragma endregion
@@ -0,0 +1,394 @@
+//
+//  FXNConfiguration.c
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include "FXNMock.h"
+
+#define FXN_CONFIGURATION_GETTER(name, type, field)                                         \
+    FXNStatus FXNConfigurationGet##name (FXNConfiguration* configuration, type* value) {    \
+        if (!configuration || !value)                                                       \
+            return FXN_ERROR_INVALID_ARGUMENT;                                              \
+        *value = configuration->field;                                                      \
+        return FXN_OK;                                                                      \
+    }
+
+#pragma region --Lifecycle--
+FXNStatus FXNConfigurationGetUniqueID (char* identifier, int32_t size) {
+    return FXNMockCopyString("mock-unique-id", identifier, size);
+}
+
+FXNStatus FXNConfigurationGetClientID (char* identifier, int32_t size) {
+    return FXNMockCopyString("mock", identifier, size);
+}
+
+FXNStatus FXNConfigurationCreate (FXNConfiguration** configuration) {
+    if (!configuration)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    FXNConfiguration* result = calloc(1, sizeof(FXNConfiguration));
+    if (!result)
+        return FXN_ERROR_INVALID_OPERATION;
+    result->numaNode = -1;
+    result->schedulingWeight = 1;
+    *configuration = result;
+    return FXN_OK;
+}
+
+static int FXNConfigurationCompareSections (const void* a, const void* b) {
+    const uint64_t x = (*(const FXNBundleSection* const*)a)->offset;
+    const uint64_t y = (*(const FXNBundleSection* const*)b)->offset;
+    return (x > y) - (x < y);
+}
+
+static FXNStatus FXNConfigurationLoadManifest (
+    FXNConfiguration* configuration,
+    const char* manifest,
+    size_t size
+) {
+    // The manifest section is not NUL-terminated
+    char* json = malloc(size + 1);
+    if (!json)
+        return FXN_ERROR_INVALID_OPERATION;
+    memcpy(json, manifest, size);
+    json[size] = '\0';
+    FXNValue* value = NULL;
+    FXNStatus status = FXNMockDecodeJSON(json, &value);
+    free(json);
+    if (status != FXN_OK)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    // Extract tag
+    FXNValue* tag = NULL;
+    if (value->type == FXN_DTYPE_DICT && value->map)
+        FXNValueMapGetValue(value->map, "tag", &tag);
+    if (tag && tag->type == FXN_DTYPE_STRING) {
+        free(configuration->tag);
+        configuration->tag = FXNMockDuplicateString(tag->data);
+        status = configuration->tag ? FXN_OK : FXN_ERROR_INVALID_OPERATION;
+    } else
+        status = FXN_ERROR_INVALID_ARGUMENT;
+    FXNValueRelease(value);
+    return status;
+}
+
+static FXNStatus FXNConfigurationLoadBundle (FXNConfiguration* configuration, const char* path) {
+    const uint8_t* bundle = configuration->bundle->data;
+    const size_t size = configuration->bundle->size;
+    // Validate header
+    if (size < sizeof(FXNBundleHeader))
+        return FXN_ERROR_INVALID_ARGUMENT;
+    const FXNBundleHeader* header = (const FXNBundleHeader*)bundle;
+    if (memcmp(header->magic, FXN_BUNDLE_MAGIC, sizeof(header->magic)) != 0 || header->version != FXN_BUNDLE_VERSION)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    if (header->alignment < FXN_BUNDLE_MIN_ALIGNMENT || (header->alignment & (header->alignment - 1)) != 0)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    if (header->reserved != 0)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    const size_t tableSize = sizeof(FXNBundleSection) * header->sectionCount;
+    if (tableSize > size - sizeof(FXNBundleHeader))
+        return FXN_ERROR_INVALID_ARGUMENT;
+    const FXNBundleSection* sections = (const FXNBundleSection*)(bundle + sizeof(FXNBundleHeader));
+    if (FXNMockHash(sections, tableSize, 0) != header->checksum)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    // Validate section bounds, so sections lie after the section table, within the bundle, and do not overlap
+    const FXNBundleSection** ordered = malloc(sizeof(FXNBundleSection*) * (header->sectionCount > 0 ? header->sectionCount : 1));
+    if (!ordered)
+        return FXN_ERROR_INVALID_OPERATION;
+    for (uint32_t i = 0; i < header->sectionCount; ++i)
+        ordered[i] = &sections[i];
+    qsort(ordered, header->sectionCount, sizeof(FXNBundleSection*), FXNConfigurationCompareSections);
+    uint64_t end = sizeof(FXNBundleHeader) + tableSize;
+    bool valid = true;
+    for (uint32_t i = 0; valid && i < header->sectionCount; ++i) {
+        const FXNBundleSection* section = ordered[i];
+        valid =
+            section->offset % header->alignment == 0 &&
+            section->offset >= end &&
+            section->offset <= size &&
+            section->size <= size - section->offset;
+        end = section->offset + section->size;
+    }
+    free(ordered);
+    if (!valid)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    // Validate sections
+    const char* manifest = NULL;
+    size_t manifestSize = 0;
+    for (uint32_t i = 0; i < header->sectionCount; ++i) {
+        const FXNBundleSection* section = &sections[i];
+        if (section->flags != 0 || memchr(section->name, '\0', sizeof(section->name)) == NULL)
+            return FXN_ERROR_INVALID_ARGUMENT;
+        if (FXNMockHash(bundle + section->offset, section->size, 0) != section->checksum)
+            return FXN_ERROR_INVALID_ARGUMENT;
+        if (section->type == FXN_BUNDLE_SECTION_MANIFEST) {
+            if (manifest)
+                return FXN_ERROR_INVALID_ARGUMENT;
+            manifest = (const char*)(bundle + section->offset);
+            manifestSize = section->size;
+        } else if (section->type == FXN_BUNDLE_SECTION_WEIGHTS) {
+            FXNStatus status = FXNConfigurationAddResource(configuration, section->name, path);
+            if (status != FXN_OK)
+                return status;
+            // Weights are referenced in place, so the resource keeps the bundle mapped
+            struct FXNMockResource* resource = &configuration->resources[configuration->resourceCount - 1];
+            resource->mapping = FXNMockRetainMapping(configuration->bundle);
+            resource->offset = section->offset;
+            resource->size = section->size;
+        }
+    }
+    if (!manifest)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    return FXNConfigurationLoadManifest(configuration, manifest, manifestSize);
+}
+
+FXNStatus FXNConfigurationCreateFromBundle (const char* path, FXNConfiguration** configuration) {
+    if (!path || !configuration)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    // Map the bundle for the lifetime of the configuration
+    FXNConfiguration* result = NULL;
+    FXNStatus status = FXNConfigurationCreate(&result);
+    if (status == FXN_OK)
+        status = FXNMockMapFile(path, &result->bundle);
+    if (status == FXN_OK)
+        status = FXNConfigurationLoadBundle(result, path);
+    if (status != FXN_OK) {
+        FXNConfigurationRelease(result);
+        return status;
+    }
+    *configuration = result;
+    return FXN_OK;
+}
+
+FXNStatus FXNConfigurationRelease (FXNConfiguration* configuration) {
+    if (!configuration)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    for (int32_t i = 0; i < configuration->resourceCount; ++i)
+        FXNMockReleaseResource(&configuration->resources[i]);
+    free(configuration->resources);
+    FXNMockReleaseMapping(configuration->bundle);
+    free(configuration->affinity);
+    free(configuration->tag);
+    free(configuration->token);
+    free(configuration->recordingPath);
+    free(configuration);
+    return FXN_OK;
+}
+#pragma endregion
+
+
+#pragma region --Configuration--
+FXNStatus FXNConfigurationGetTag (FXNConfiguration* configuration, char* tag, int32_t size) {
+    if (!configuration)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    return FXNMockCopyString(configuration->tag, tag, size);
+}
+
+FXNStatus FXNConfigurationSetTag (FXNConfiguration* configuration, const char* tag) {
+    if (!configuration)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    free(configuration->tag);
+    configuration->tag = FXNMockDuplicateString(tag);
+    return tag && !configuration->tag ? FXN_ERROR_INVALID_OPERATION : FXN_OK;
+}
+
+FXNStatus FXNConfigurationGetToken (FXNConfiguration* configuration, char* token, int32_t size) {
+    if (!configuration)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    return FXNMockCopyString(configuration->token, token, size);
+}
+
+FXNStatus FXNConfigurationSetToken (FXNConfiguration* configuration, const char* token) {
+    if (!configuration)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    free(configuration->token);
+    configuration->token = FXNMockDuplicateString(token);
+    return token && !configuration->token ? FXN_ERROR_INVALID_OPERATION : FXN_OK;
+}
+
+FXN_CONFIGURATION_GETTER(Acceleration, FXNAcceleration, acceleration)
+
+FXNStatus FXNConfigurationSetAcceleration (FXNConfiguration* configuration, FXNAcceleration acceleration) {
+    if (!configuration)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    configuration->acceleration = acceleration;
+    return FXN_OK;
+}
+
+FXN_CONFIGURATION_GETTER(Device, void*, device)
+
+FXNStatus FXNConfigurationSetDevice (FXNConfiguration* configuration, void* device) {
+    if (!configuration)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    configuration->device = device;
+    return FXN_OK;
+}
+
+FXN_CONFIGURATION_GETTER(ThreadPolicy, FXNThreadPolicy, threadPolicy)
+
+FXNStatus FXNConfigurationSetThreadPolicy (FXNConfiguration* configuration, FXNThreadPolicy policy) {
+    if (!configuration || policy < FXN_THREAD_POLICY_AUTO || policy > FXN_THREAD_POLICY_SHARED)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    configuration->threadPolicy = policy;
+    return FXN_OK;
+}
+
+FXN_CONFIGURATION_GETTER(IntraOpThreads, int32_t, intraOpThreads)
+
+FXNStatus FXNConfigurationSetIntraOpThreads (FXNConfiguration* configuration, int32_t threads) {
+    if (!configuration || threads < 0)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    configuration->intraOpThreads = threads;
+    return FXN_OK;
+}
+
+FXN_CONFIGURATION_GETTER(InterOpThreads, int32_t, interOpThreads)
+
+FXNStatus FXNConfigurationSetInterOpThreads (FXNConfiguration* configuration, int32_t threads) {
+    if (!configuration || threads < 0)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    configuration->interOpThreads = threads;
+    return FXN_OK;
+}
+
+FXNStatus FXNConfigurationGetCPUAffinity (
+    FXNConfiguration* configuration,
+    int32_t* cores,
+    int32_t size,
+    int32_t* count
+) {
+    if (!configuration || !count || (!cores && size > 0))
+        return FXN_ERROR_INVALID_ARGUMENT;
+    const int32_t copied = size < configuration->affinityCount ? size : configuration->affinityCount;
+    if (copied > 0)
+        memcpy(cores, configuration->affinity, sizeof(int32_t) * (size_t)copied);
+    *count = configuration->affinityCount;
+    return FXN_OK;
+}
+
+FXNStatus FXNConfigurationSetCPUAffinity (
+    FXNConfiguration* configuration,
+    const int32_t* cores,
+    int32_t count
+) {
+    if (!configuration || count < 0 || (!cores && count > 0))
+        return FXN_ERROR_INVALID_ARGUMENT;
+    for (int32_t i = 0; i < count; ++i)
+        if (cores[i] < 0)
+            return FXN_ERROR_INVALID_ARGUMENT;
+#if !defined(__linux__)
+    if (count > 0)
+        return FXN_ERROR_NOT_IMPLEMENTED;
+#endif
+    int32_t* affinity = NULL;
+    if (cores && count > 0) {
+        affinity = malloc(sizeof(int32_t) * (size_t)count);
+        if (!affinity)
+            return FXN_ERROR_INVALID_OPERATION;
+        memcpy(affinity, cores, sizeof(int32_t) * (size_t)count);
+    }
+    free(configuration->affinity);
+    configuration->affinity = affinity;
+    configuration->affinityCount = affinity ? count : 0;
+    return FXN_OK;
+}
+
+FXN_CONFIGURATION_GETTER(NUMANode, int32_t, numaNode)
+
+FXNStatus FXNConfigurationSetNUMANode (FXNConfiguration* configuration, int32_t node) {
+    if (!configuration || node < -1)
+        return FXN_ERROR_INVALID_ARGUMENT;
+#if !defined(__linux__)
+    if (node >= 0)
+        return FXN_ERROR_NOT_IMPLEMENTED;
+#endif
+    configuration->numaNode = node;
+    return FXN_OK;
+}
+
+FXN_CONFIGURATION_GETTER(NUMAPolicy, FXNNUMAPolicy, numaPolicy)
+
+FXNStatus FXNConfigurationSetNUMAPolicy (FXNConfiguration* configuration, FXNNUMAPolicy policy) {
+    if (!configuration || policy < FXN_NUMA_POLICY_AUTO || policy > FXN_NUMA_POLICY_REPLICATE)
+        return FXN_ERROR_INVALID_ARGUMENT;
+#if !defined(__linux__)
+    if (policy != FXN_NUMA_POLICY_AUTO)
+        return FXN_ERROR_NOT_IMPLEMENTED;
+#endif
+    configuration->numaPolicy = policy;
+    return FXN_OK;
+}
+
+FXN_CONFIGURATION_GETTER(Priority, FXNPriority, priority)
+
+FXNStatus FXNConfigurationSetPriority (FXNConfiguration* configuration, FXNPriority priority) {
+    if (!configuration || priority < FXN_PRIORITY_NORMAL || priority > FXN_PRIORITY_HIGH)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    configuration->priority = priority;
+    return FXN_OK;
+}
+
+FXN_CONFIGURATION_GETTER(SchedulingWeight, int32_t, schedulingWeight)
+
+FXNStatus FXNConfigurationSetSchedulingWeight (FXNConfiguration* configuration, int32_t weight) {
+    if (!configuration || weight <= 0)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    configuration->schedulingWeight = weight;
+    return FXN_OK;
+}
+
+FXN_CONFIGURATION_GETTER(ResultCacheCapacity, int64_t, resultCacheCapacity)
+
+FXNStatus FXNConfigurationSetResultCacheCapacity (FXNConfiguration* configuration, int64_t capacity) {
+    if (!configuration || capacity < 0)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    configuration->resultCacheCapacity = capacity;
+    return FXN_OK;
+}
+
+FXN_CONFIGURATION_GETTER(SharedMemoryOutputs, bool, sharedMemoryOutputs)
+
+FXNStatus FXNConfigurationSetSharedMemoryOutputs (FXNConfiguration* configuration, bool enabled) {
+    if (!configuration)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    configuration->sharedMemoryOutputs = enabled;
+    return FXN_OK;
+}
+
+FXNStatus FXNConfigurationGetRecordingPath (FXNConfiguration* configuration, char* path, int32_t size) {
+    if (!configuration)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    return FXNMockCopyString(configuration->recordingPath, path, size);
+}
+
+FXNStatus FXNConfigurationSetRecordingPath (FXNConfiguration* configuration, const char* path) {
+    if (!configuration)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    free(configuration->recordingPath);
+    configuration->recordingPath = FXNMockDuplicateString(path);
+    return path && !configuration->recordingPath ? FXN_ERROR_INVALID_OPERATION : FXN_OK;
+}
+
+FXNStatus FXNConfigurationAddResource (FXNConfiguration* configuration, const char* type, const char* path) {
+    if (!configuration || !type || !path)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    struct FXNMockResource* resources = realloc(
+        configuration->resources,
+        sizeof(struct FXNMockResource) * (size_t)(configuration->resourceCount + 1)
+    );
+    if (!resources)
+        return FXN_ERROR_INVALID_OPERATION;
+    configuration->resources = resources;
+    struct FXNMockResource resource = { .type = FXNMockDuplicateString(type), .path = FXNMockDuplicateString(path) };
+    if (!resource.type || !resource.path) {
+        free(resource.type);
+        free(resource.path);
+        return FXN_ERROR_INVALID_OPERATION;
+    }
+    resources[configuration->resourceCount++] = resource;
+    return FXN_OK;
+}
+#pragma endregion
@@ -0,0 +1,327 @@
+//
+//  FXNExecutor.c
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#if defined(__linux__)
+#define _GNU_SOURCE
+#include <sched.h>
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "FXNMock.h"
+
+/*!
+ Callers split their work into chunks and block until every chunk has completed.
+ Worker threads take chunks from the queued jobs, so a single busy predictor can use every worker.
+ Jobs live on the stack of the calling thread, and are unlinked once all of their chunks have been taken.
+ Asynchronous jobs are allocated instead, and the worker which completes their last chunk
+ invokes their completion and frees them.
+
+ Workers take chunks from the highest priority jobs first. Among jobs with the same priority,
+ predictors share workers in proportion to their weights with stride scheduling:
+ each chunk advances the pass of its predictor by a stride inversely proportional to the predictor weight,
+ and workers take chunks from the job whose predictor has the lowest pass.
+*/
+struct FXNMockJob {
+    void (*function) (void* context, int64_t index);
+    void (*completion) (void* context);
+    void* context;
+    int64_t count;
+    int64_t claimed;
+    int64_t completed;
+    struct FXNMockSchedule* schedule;
+    struct FXNMockJob* next;
+};
+
+#define FXN_EXECUTOR_STRIDE (1u << 20)
+
+struct FXNMockExecutor {
+    pthread_mutex_t lock;
+    pthread_cond_t pending;
+    pthread_cond_t completed;
+    pthread_t* threads;
+    int32_t threadCount;
+    struct FXNMockJob* head;
+    struct FXNMockJob* tail;
+    uint64_t pass;
+    bool closed;
+};
+
+// Jobs submitted from a worker thread run inline, since waiting on the pool could wait on the worker itself
+static _Thread_local struct FXNMockExecutor* FXNExecutorCurrent = NULL;
+
+static int32_t FXNExecutorGetRank (FXNPriority priority) {
+    switch (priority) {
+        case FXN_PRIORITY_HIGH: return 0;
+        case FXN_PRIORITY_LOW:  return 2;
+        default:                return 1;
+    }
+}
+
+static struct FXNMockJob* FXNExecutorClaim (struct FXNMockExecutor* executor, int64_t* index) {
+    // Find the highest priority job with the lowest pass, preferring older jobs on ties
+    struct FXNMockJob* previous = NULL;
+    struct FXNMockJob* selectedPrevious = NULL;
+    struct FXNMockJob* selected = NULL;
+    for (struct FXNMockJob* job = executor->head; job; previous = job, job = job->next) {
+        const int32_t rank = FXNExecutorGetRank(job->schedule->priority);
+        const int32_t selectedRank = selected ? FXNExecutorGetRank(selected->schedule->priority) : INT32_MAX;
+        if (rank < selectedRank || (rank == selectedRank && job->schedule->pass < selected->schedule->pass)) {
+            selected = job;
+            selectedPrevious = previous;
+        }
+    }
+    // Claim the next chunk, unlinking the job once every chunk has been claimed
+    *index = selected->claimed++;
+    if (selected->claimed == selected->count) {
+        if (selectedPrevious)
+            selectedPrevious->next = selected->next;
+        else
+            executor->head = selected->next;
+        if (executor->tail == selected)
+            executor->tail = selectedPrevious;
+    }
+    if (selected->schedule->pass > executor->pass)
+        executor->pass = selected->schedule->pass;
+    selected->schedule->pass += FXN_EXECUTOR_STRIDE / (uint32_t)selected->schedule->weight;
+    return selected;
+}
+
+static void* FXNExecutorWorker (void* context) {
+    struct FXNMockExecutor* executor = context;
+    FXNExecutorCurrent = executor;
+    pthread_mutex_lock(&executor->lock);
+    for (;;) {
+        while (!executor->head && !executor->closed)
+            pthread_cond_wait(&executor->pending, &executor->lock);
+        if (!executor->head)
+            break;
+        int64_t index = 0;
+        struct FXNMockJob* job = FXNExecutorClaim(executor, &index);
+        pthread_mutex_unlock(&executor->lock);
+        job->function(job->context, index);
+        pthread_mutex_lock(&executor->lock);
+        if (++job->completed < job->count)
+            continue;
+        --job->schedule->running;
+        pthread_cond_broadcast(&executor->completed);
+        if (job->completion) {
+            pthread_mutex_unlock(&executor->lock);
+            job->completion(job->context);
+            free(job);
+            pthread_mutex_lock(&executor->lock);
+        }
+    }
+    pthread_mutex_unlock(&executor->lock);
+    return NULL;
+}
+
+#if defined(__linux__)
+static FXNStatus FXNExecutorAddNodeCores (int32_t node, cpu_set_t* cores) {
+    char path[64];
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+    FILE* file = fopen(path, "r");
+    if (!file)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    // The list is formatted as comma-separated ranges, like `0-3,8-11`
+    int first = 0;
+    while (fscanf(file, "%d", &first) == 1) {
+        int last = first;
+        int separator = fgetc(file);
+        if (separator == '-' && fscanf(file, "%d", &last) == 1)
+            separator = fgetc(file);
+        for (int core = first; core >= 0 && core <= last && core < CPU_SETSIZE; ++core)
+            CPU_SET(core, cores);
+        if (separator != ',')
+            break;
+    }
+    fclose(file);
+    return FXN_OK;
+}
+
+static FXNStatus FXNExecutorGetCores (
+    const int32_t* affinity,
+    int32_t affinityCount,
+    int32_t node,
+    cpu_set_t* cores
+) {
+    CPU_ZERO(cores);
+    for (int32_t i = 0; i < affinityCount; ++i) {
+        if (affinity[i] < 0 || affinity[i] >= CPU_SETSIZE)
+            return FXN_ERROR_INVALID_ARGUMENT;
+        CPU_SET(affinity[i], cores);
+    }
+    if (node < 0)
+        return FXN_OK;
+    // Pin to the intersection of the affinity set and the cores of the NUMA node
+    cpu_set_t nodeCores;
+    CPU_ZERO(&nodeCores);
+    FXNStatus status = FXNExecutorAddNodeCores(node, &nodeCores);
+    if (status != FXN_OK)
+        return status;
+    if (affinityCount > 0)
+        CPU_AND(cores, cores, &nodeCores);
+    else
+        CPU_OR(cores, cores, &nodeCores);
+    return CPU_COUNT(cores) > 0 ? FXN_OK : FXN_ERROR_INVALID_ARGUMENT;
+}
+#endif
+
+#pragma region --Lifecycle--
+FXNStatus FXNMockCreateExecutor (
+    int32_t threads,
+    const int32_t* affinity,
+    int32_t affinityCount,
+    int32_t node,
+    struct FXNMockExecutor** executor
+) {
+    pthread_attr_t attributes;
+    pthread_attr_init(&attributes);
+#if defined(__linux__)
+    cpu_set_t cores;
+    FXNStatus status = FXNExecutorGetCores(affinity, affinityCount, node, &cores);
+    if (status != FXN_OK) {
+        pthread_attr_destroy(&attributes);
+        return status;
+    }
+    const bool pinned = affinityCount > 0 || node >= 0;
+    if (pinned)
+        pthread_attr_setaffinity_np(&attributes, sizeof(cores), &cores);
+    if (threads == 0 && pinned)
+        threads = CPU_COUNT(&cores);
+#else
+    if (affinityCount > 0 || node >= 0) {
+        pthread_attr_destroy(&attributes);
+        return FXN_ERROR_NOT_IMPLEMENTED;
+    }
+#endif
+    if (threads == 0)
+        threads = (int32_t)sysconf(_SC_NPROCESSORS_ONLN);
+    if (threads <= 0)
+        threads = 1;
+    struct FXNMockExecutor* result = calloc(1, sizeof(struct FXNMockExecutor));
+    if (result)
+        result->threads = calloc((size_t)threads, sizeof(pthread_t));
+    if (!result || !result->threads) {
+        pthread_attr_destroy(&attributes);
+        free(result);
+        return FXN_ERROR_INVALID_OPERATION;
+    }
+    pthread_mutex_init(&result->lock, NULL);
+    pthread_cond_init(&result->pending, NULL);
+    pthread_cond_init(&result->completed, NULL);
+    for (; result->threadCount < threads; ++result->threadCount)
+        if (pthread_create(&result->threads[result->threadCount], &attributes, FXNExecutorWorker, result) != 0)
+            break;
+    pthread_attr_destroy(&attributes);
+    if (result->threadCount < threads) {
+        FXNMockReleaseExecutor(result);
+        return FXN_ERROR_INVALID_OPERATION;
+    }
+    *executor = result;
+    return FXN_OK;
+}
+
+void FXNMockReleaseExecutor (struct FXNMockExecutor* executor) {
+    if (!executor)
+        return;
+    // Workers finish queued jobs before exiting
+    pthread_mutex_lock(&executor->lock);
+    executor->closed = true;
+    pthread_cond_broadcast(&executor->pending);
+    pthread_mutex_unlock(&executor->lock);
+    for (int32_t i = 0; i < executor->threadCount; ++i)
+        pthread_join(executor->threads[i], NULL);
+    pthread_cond_destroy(&executor->completed);
+    pthread_cond_destroy(&executor->pending);
+    pthread_mutex_destroy(&executor->lock);
+    free(executor->threads);
+    free(executor);
+}
+#pragma endregion
+
+
+#pragma region --Operations--
+int32_t FXNMockGetExecutorThreadCount (struct FXNMockExecutor* executor) {
+    return executor ? executor->threadCount : 1;
+}
+
+static void FXNExecutorEnqueue (struct FXNMockExecutor* executor, struct FXNMockJob* job) {
+    struct FXNMockSchedule* schedule = job->schedule;
+    // Predictors which were idle start at the current pass, so they cannot claim credit for idle time
+    if (schedule->running++ == 0 && schedule->pass < executor->pass)
+        schedule->pass = executor->pass;
+    if (executor->tail)
+        executor->tail->next = job;
+    else
+        executor->head = job;
+    executor->tail = job;
+    pthread_cond_broadcast(&executor->pending);
+}
+
+void FXNMockExecute (
+    struct FXNMockExecutor* executor,
+    struct FXNMockSchedule* schedule,
+    int64_t count,
+    void (*function) (void* context, int64_t index),
+    void* context
+) {
+    if (!executor || executor == FXNExecutorCurrent) {
+        for (int64_t i = 0; i < count; ++i)
+            function(context, i);
+        return;
+    }
+    if (count <= 0)
+        return;
+    struct FXNMockJob job = { .function = function, .context = context, .count = count, .schedule = schedule };
+    pthread_mutex_lock(&executor->lock);
+    // Bound the number of concurrent jobs from the predictor
+    while (schedule->concurrency > 0 && schedule->running >= schedule->concurrency)
+        pthread_cond_wait(&executor->completed, &executor->lock);
+    FXNExecutorEnqueue(executor, &job);
+    while (job.completed < job.count)
+        pthread_cond_wait(&executor->completed, &executor->lock);
+    pthread_mutex_unlock(&executor->lock);
+}
+
+FXNStatus FXNMockExecuteAsync (
+    struct FXNMockExecutor* executor,
+    struct FXNMockSchedule* schedule,
+    int64_t count,
+    void (*function) (void* context, int64_t index),
+    void (*completion) (void* context),
+    void* context
+) {
+    if (!executor || count <= 0)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    struct FXNMockJob* job = calloc(1, sizeof(struct FXNMockJob));
+    if (!job)
+        return FXN_ERROR_INVALID_OPERATION;
+    *job = (struct FXNMockJob) {
+        .function = function,
+        .completion = completion,
+        .context = context,
+        .count = count,
+        .schedule = schedule
+    };
+    // Asynchronous jobs are not bounded by the schedule concurrency, since the caller cannot wait
+    pthread_mutex_lock(&executor->lock);
+    FXNExecutorEnqueue(executor, job);
+    pthread_mutex_unlock(&executor->lock);
+    return FXN_OK;
+}
+
+void FXNMockParallelFor (
+    FXNPredictor* predictor,
+    int64_t count,
+    void (*function) (void* context, int64_t index),
+    void* context
+) {
+    FXNMockExecute(predictor->executor, &predictor->schedule, count, function, context);
+}
+#pragma endregion
@@ -0,0 +1,605 @@
+//
+//  FXNJSON.c
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#include <errno.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FXNMock.h"
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#pragma region --Decoding--
+// Deeper containers are rejected when skipped over for lazy decoding
+#define FXN_JSON_MAX_DEPTH 256
+
+struct FXNJSONParser {
+    const char* p;
+    const char* end;
+    bool nested;
+};
+
+static FXNStatus FXNJSONParseValue (struct FXNJSONParser* parser, FXNValue** value);
+
+static void FXNJSONSkipWhitespace (struct FXNJSONParser* parser) {
+    while (parser->p < parser->end && (*parser->p == ' ' || *parser->p == '\t' || *parser->p == '\n' || *parser->p == '\r'))
+        ++parser->p;
+}
+
+static bool FXNJSONConsume (struct FXNJSONParser* parser, char c) {
+    FXNJSONSkipWhitespace(parser);
+    if (parser->p < parser->end && *parser->p == c) {
+        ++parser->p;
+        return true;
+    }
+    return false;
+}
+
+static const char* FXNJSONScanString (const char* p, const char* end, bool* escaped) {
+#if defined(__SSE2__)
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    while (end - p >= 16) {
+        const __m128i chunk = _mm_loadu_si128((const __m128i*)p);
+        const int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)));
+        if (!mask) {
+            p += 16;
+            continue;
+        }
+        p += __builtin_ctz((unsigned)mask);
+        if (*p == '"')
+            return p;
+        *escaped = true;
+        p += 2;
+    }
+#endif
+    while (p < end) {
+        if (*p == '"')
+            return p;
+        if (*p == '\\') {
+            *escaped = true;
+            p += 2;
+        } else
+            ++p;
+    }
+    return end;
+}
+
+static const char* FXNJSONSkipContainer (const char* p, const char* end) {
+    char closers[FXN_JSON_MAX_DEPTH];
+    int32_t depth = 0;
+    while (p < end) {
+#if defined(__SSE2__)
+        // Skip over chunks without any structural characters
+        const __m128i quote = _mm_set1_epi8('"');
+        const __m128i open = _mm_set1_epi8('[');
+        const __m128i close = _mm_set1_epi8(']');
+        const __m128i openBrace = _mm_set1_epi8('{');
+        const __m128i closeBrace = _mm_set1_epi8('}');
+        while (end - p >= 16) {
+            const __m128i chunk = _mm_loadu_si128((const __m128i*)p);
+            const __m128i brackets = _mm_or_si128(_mm_cmpeq_epi8(chunk, open), _mm_cmpeq_epi8(chunk, close));
+            const __m128i braces = _mm_or_si128(_mm_cmpeq_epi8(chunk, openBrace), _mm_cmpeq_epi8(chunk, closeBrace));
+            const int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_or_si128(brackets, braces)));
+            if (mask) {
+                p += __builtin_ctz((unsigned)mask);
+                break;
+            }
+            p += 16;
+        }
+        if (p >= end)
+            break;
+#endif
+        bool escaped = false;
+        switch (*p) {
+            case '"':
+                p = FXNJSONScanString(p + 1, end, &escaped);
+                if (p >= end)
+                    return NULL;
+                break;
+            case '[':
+            case '{':
+                if (depth == FXN_JSON_MAX_DEPTH)
+                    return NULL;
+                closers[depth++] = *p == '[' ? ']' : '}';
+                break;
+            case ']':
+            case '}':
+                if (depth == 0 || closers[--depth] != *p)
+                    return NULL;
+                if (depth == 0)
+                    return p + 1;
+                break;
+        }
+        ++p;
+    }
+    return NULL;
+}
+
+static FXNStatus FXNJSONCaptureContainer (struct FXNJSONParser* parser, FXNValue** value) {
+    const char* start = parser->p;
+    const char* stop = FXNJSONSkipContainer(start, parser->end);
+    if (!stop)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    FXNValue* result = calloc(1, sizeof(FXNValue));
+    if (!result)
+        return FXN_ERROR_INVALID_OPERATION;
+    result->type = *start == '[' ? FXN_DTYPE_LIST : FXN_DTYPE_DICT;
+    result->size = (size_t)(stop - start) + 1;
+    result->data = malloc(result->size);
+    result->owner = true;
+    if (!result->data) {
+        free(result);
+        return FXN_ERROR_INVALID_OPERATION;
+    }
+    memcpy(result->data, start, result->size - 1);
+    ((char*)result->data)[result->size - 1] = '\0';
+    parser->p = stop;
+    *value = result;
+    return FXN_OK;
+}
+
+static size_t FXNJSONEncodeUTF8 (uint32_t codepoint, char* out) {
+    if (codepoint < 0x80) {
+        out[0] = (char)codepoint;
+        return 1;
+    } else if (codepoint < 0x800) {
+        out[0] = (char)(0xC0 | (codepoint >> 6));
+        out[1] = (char)(0x80 | (codepoint & 0x3F));
+        return 2;
+    } else if (codepoint < 0x10000) {
+        out[0] = (char)(0xE0 | (codepoint >> 12));
+        out[1] = (char)(0x80 | ((codepoint >> 6) & 0x3F));
+        out[2] = (char)(0x80 | (codepoint & 0x3F));
+        return 3;
+    }
+    out[0] = (char)(0xF0 | (codepoint >> 18));
+    out[1] = (char)(0x80 | ((codepoint >> 12) & 0x3F));
+    out[2] = (char)(0x80 | ((codepoint >> 6) & 0x3F));
+    out[3] = (char)(0x80 | (codepoint & 0x3F));
+    return 4;
+}
+
+static bool FXNJSONParseHex (const char* p, uint32_t* result) {
+    *result = 0;
+    for (int i = 0; i < 4; ++i) {
+        const char c = p[i];
+        *result <<= 4;
+        if (c >= '0' && c <= '9')
+            *result |= (uint32_t)(c - '0');
+        else if (c >= 'a' && c <= 'f')
+            *result |= (uint32_t)(c - 'a' + 10);
+        else if (c >= 'A' && c <= 'F')
+            *result |= (uint32_t)(c - 'A' + 10);
+        else
+            return false;
+    }
+    return true;
+}
+
+static FXNStatus FXNJSONParseString (struct FXNJSONParser* parser, char** string) {
+    if (!FXNJSONConsume(parser, '"'))
+        return FXN_ERROR_INVALID_ARGUMENT;
+    bool escaped = false;
+    const char* start = parser->p;
+    const char* stop = FXNJSONScanString(start, parser->end, &escaped);
+    if (stop >= parser->end)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    // Escaped strings are never longer than their encoding
+    char* result = malloc((size_t)(stop - start) + 1);
+    if (!result)
+        return FXN_ERROR_INVALID_OPERATION;
+    if (!escaped) {
+        memcpy(result, start, (size_t)(stop - start));
+        result[stop - start] = '\0';
+        parser->p = stop + 1;
+        *string = result;
+        return FXN_OK;
+    }
+    char* out = result;
+    for (const char* p = start; p < stop; ++p) {
+        if (*p != '\\') {
+            *out++ = *p;
+            continue;
+        }
+        switch (*++p) {
+            case 'b':   *out++ = '\b'; break;
+            case 'f':   *out++ = '\f'; break;
+            case 'n':   *out++ = '\n'; break;
+            case 'r':   *out++ = '\r'; break;
+            case 't':   *out++ = '\t'; break;
+            case 'u': {
+                uint32_t codepoint = 0, low = 0;
+                if (stop - p < 5 || !FXNJSONParseHex(p + 1, &codepoint)) {
+                    free(result);
+                    return FXN_ERROR_INVALID_ARGUMENT;
+                }
+                p += 4;
+                // Surrogates must form a high and low pair
+                if (codepoint >= 0xD800 && codepoint < 0xDC00) {
+                    if (stop - p < 7 || p[1] != '\\' || p[2] != 'u' || !FXNJSONParseHex(p + 3, &low) || low < 0xDC00 || low > 0xDFFF) {
+                        free(result);
+                        return FXN_ERROR_INVALID_ARGUMENT;
+                    }
+                    codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+                    p += 6;
+                } else if (codepoint >= 0xDC00 && codepoint <= 0xDFFF) {
+                    free(result);
+                    return FXN_ERROR_INVALID_ARGUMENT;
+                }
+                out += FXNJSONEncodeUTF8(codepoint, out);
+                break;
+            }
+            default:    *out++ = *p; break;
+        }
+    }
+    *out = '\0';
+    parser->p = stop + 1;
+    *string = result;
+    return FXN_OK;
+}
+
+static size_t FXNJSONSkipDigits (struct FXNJSONParser* parser) {
+    const char* start = parser->p;
+    while (parser->p < parser->end && *parser->p >= '0' && *parser->p <= '9')
+        ++parser->p;
+    return (size_t)(parser->p - start);
+}
+
+static FXNStatus FXNJSONParseNumber (struct FXNJSONParser* parser, FXNValue** value) {
+    // Validate the JSON number grammar: -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+    const char* start = parser->p;
+    bool integer = true;
+    if (parser->p < parser->end && *parser->p == '-')
+        ++parser->p;
+    const char* digits = parser->p;
+    const size_t count = FXNJSONSkipDigits(parser);
+    if (count == 0 || (count > 1 && *digits == '0'))
+        return FXN_ERROR_INVALID_ARGUMENT;
+    if (parser->p < parser->end && *parser->p == '.') {
+        ++parser->p;
+        integer = false;
+        if (FXNJSONSkipDigits(parser) == 0)
+            return FXN_ERROR_INVALID_ARGUMENT;
+    }
+    if (parser->p < parser->end && (*parser->p == 'e' || *parser->p == 'E')) {
+        ++parser->p;
+        integer = false;
+        if (parser->p < parser->end && (*parser->p == '+' || *parser->p == '-'))
+            ++parser->p;
+        if (FXNJSONSkipDigits(parser) == 0)
+            return FXN_ERROR_INVALID_ARGUMENT;
+    }
+    char buffer[64];
+    const size_t length = (size_t)(parser->p - start);
+    if (length >= sizeof(buffer))
+        return FXN_ERROR_INVALID_ARGUMENT;
+    memcpy(buffer, start, length);
+    buffer[length] = '\0';
+    if (integer) {
+        errno = 0;
+        const int64_t number = strtoll(buffer, NULL, 10);
+        // Integers which do not fit in 64 bits are decoded as floats
+        if (errno != ERANGE)
+            return FXNValueCreateArray((void*)&number, NULL, 0, FXN_DTYPE_INT64, FXN_VALUE_FLAG_COPY_DATA, value);
+    }
+    const double number = strtod(buffer, NULL);
+    return FXNValueCreateArray((void*)&number, NULL, 0, FXN_DTYPE_FLOAT64, FXN_VALUE_FLAG_COPY_DATA, value);
+}
+
+static FXNStatus FXNJSONParseList (struct FXNJSONParser* parser, FXNValue** value) {
+    FXNValue** items = NULL;
+    int32_t count = 0, capacity = 0;
+    FXNStatus status = FXN_OK;
+    ++parser->p;
+    if (!FXNJSONConsume(parser, ']')) {
+        do {
+            if (count == capacity) {
+                const int32_t size = capacity > 0 ? 2 * capacity : 8;
+                FXNValue** resized = realloc(items, sizeof(FXNValue*) * (size_t)size);
+                if (!resized) {
+                    status = FXN_ERROR_INVALID_OPERATION;
+                    break;
+                }
+                items = resized;
+                capacity = size;
+            }
+            status = FXNJSONParseValue(parser, &items[count]);
+            if (status != FXN_OK)
+                break;
+            ++count;
+        } while (FXNJSONConsume(parser, ','));
+        if (status == FXN_OK && !FXNJSONConsume(parser, ']'))
+            status = FXN_ERROR_INVALID_ARGUMENT;
+    }
+    if (status == FXN_OK)
+        status = FXNValueCreateListFromValues(items, count, value);
+    if (status != FXN_OK)
+        for (int32_t i = 0; i < count; ++i)
+            FXNValueRelease(items[i]);
+    free(items);
+    return status;
+}
+
+static FXNStatus FXNJSONParseDict (struct FXNJSONParser* parser, FXNValue** value) {
+    FXNValueMap* map = NULL;
+    FXNStatus status = FXNValueMapCreate(&map);
+    ++parser->p;
+    if (status == FXN_OK && !FXNJSONConsume(parser, '}')) {
+        do {
+            char* key = NULL;
+            FXNValue* item = NULL;
+            FXNJSONSkipWhitespace(parser);
+            status = FXNJSONParseString(parser, &key);
+            if (status == FXN_OK && !FXNJSONConsume(parser, ':'))
+                status = FXN_ERROR_INVALID_ARGUMENT;
+            if (status == FXN_OK)
+                status = FXNJSONParseValue(parser, &item);
+            if (status != FXN_OK) {
+                free(key);
+                break;
+            }
+            // Append without a key lookup, so duplicate keys resolve to their first occurrence
+            if (map->size == map->capacity) {
+                const int32_t capacity = map->capacity > 0 ? 2 * map->capacity : 8;
+                struct FXNValueMapEntry* entries = realloc(map->entries, sizeof(struct FXNValueMapEntry) * (size_t)capacity);
+                if (!entries) {
+                    free(key);
+                    FXNValueRelease(item);
+                    status = FXN_ERROR_INVALID_OPERATION;
+                    break;
+                }
+                map->entries = entries;
+                map->capacity = capacity;
+            }
+            map->entries[map->size].key = key;
+            map->entries[map->size].value = item;
+            ++map->size;
+        } while (FXNJSONConsume(parser, ','));
+        if (status == FXN_OK && !FXNJSONConsume(parser, '}'))
+            status = FXN_ERROR_INVALID_ARGUMENT;
+    }
+    if (status == FXN_OK)
+        return FXNValueCreateDictFromValueMap(map, value);
+    FXNValueMapRelease(map);
+    return status;
+}
+
+static FXNStatus FXNJSONParseLiteral (struct FXNJSONParser* parser, const char* literal) {
+    const size_t length = strlen(literal);
+    if ((size_t)(parser->end - parser->p) < length || strncmp(parser->p, literal, length) != 0)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    parser->p += length;
+    return FXN_OK;
+}
+
+static FXNStatus FXNJSONParseValue (struct FXNJSONParser* parser, FXNValue** value) {
+    FXNJSONSkipWhitespace(parser);
+    if (parser->p >= parser->end)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    // Nested containers are only decoded when their items are accessed
+    if ((*parser->p == '[' || *parser->p == '{') && parser->nested)
+        return FXNJSONCaptureContainer(parser, value);
+    parser->nested = true;
+    switch (*parser->p) {
+        case '[':   return FXNJSONParseList(parser, value);
+        case '{':   return FXNJSONParseDict(parser, value);
+        case '"': {
+            char* string = NULL;
+            FXNStatus status = FXNJSONParseString(parser, &string);
+            if (status == FXN_OK)
+                status = FXNValueCreateString(string, value);
+            free(string);
+            return status;
+        }
+        case 't':
+        case 'f': {
+            const bool flag = *parser->p == 't';
+            FXNStatus status = FXNJSONParseLiteral(parser, flag ? "true" : "false");
+            return status == FXN_OK ? FXNValueCreateArray((void*)&flag, NULL, 0, FXN_DTYPE_BOOL, FXN_VALUE_FLAG_COPY_DATA, value) : status;
+        }
+        case 'n': {
+            FXNStatus status = FXNJSONParseLiteral(parser, "null");
+            return status == FXN_OK ? FXNValueCreateNull(value) : status;
+        }
+        default:    return FXNJSONParseNumber(parser, value);
+    }
+}
+
+FXNStatus FXNMockDecodeJSON (const char* json, FXNValue** value) {
+    if (!json || !value)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    struct FXNJSONParser parser = { .p = json, .end = json + strlen(json), .nested = false };
+    FXNStatus status = FXNJSONParseValue(&parser, value);
+    FXNJSONSkipWhitespace(&parser);
+    if (status == FXN_OK && parser.p != parser.end) {
+        FXNValueRelease(*value);
+        *value = NULL;
+        return FXN_ERROR_INVALID_ARGUMENT;
+    }
+    return status;
+}
+#pragma endregion
+
+
+#pragma region --Encoding--
+struct FXNJSONWriter {
+    char* data;
+    size_t size;
+    size_t capacity;
+    bool failed;
+};
+
+static void FXNJSONWrite (struct FXNJSONWriter* writer, const char* data, size_t size) {
+    if (writer->failed)
+        return;
+    if (writer->size + size + 1 > writer->capacity) {
+        const size_t capacity = 2 * (writer->size + size + 1);
+        char* resized = realloc(writer->data, capacity);
+        if (!resized) {
+            writer->failed = true;
+            return;
+        }
+        writer->data = resized;
+        writer->capacity = capacity;
+    }
+    memcpy(writer->data + writer->size, data, size);
+    writer->size += size;
+    writer->data[writer->size] = '\0';
+}
+
+
+static void FXNJSONWriteString (struct FXNJSONWriter* writer, const char* string) {
+    FXNJSONWrite(writer, "\"", 1);
+    for (const char* p = string; *p; ++p) {
+        const unsigned char c = (unsigned char)*p;
+        char escape[8];
+        switch (c) {
+            case '"':   FXNJSONWrite(writer, "\\\"", 2); break;
+            case '\\':  FXNJSONWrite(writer, "\\\\", 2); break;
+            case '\n':  FXNJSONWrite(writer, "\\n", 2); break;
+            case '\r':  FXNJSONWrite(writer, "\\r", 2); break;
+            case '\t':  FXNJSONWrite(writer, "\\t", 2); break;
+            default:
+                if (c < 0x20) {
+                    snprintf(escape, sizeof(escape), "\\u%04x", c);
+                    FXNJSONWrite(writer, escape, 6);
+                } else
+                    FXNJSONWrite(writer, p, 1);
+                break;
+        }
+    }
+    FXNJSONWrite(writer, "\"", 1);
+}
+
+static float FXNJSONHalfToFloat (uint16_t half) {
+    const int sign = (half >> 15) & 0x1;
+    const int exponent = (half >> 10) & 0x1F;
+    const int mantissa = half & 0x3FF;
+    float result;
+    if (exponent == 0)
+        result = ldexpf((float)mantissa, -24);
+    else if (exponent == 31)
+        result = mantissa ? NAN : INFINITY;
+    else
+        result = ldexpf((float)(mantissa | 0x400), exponent - 25);
+    return sign ? -result : result;
+}
+
+static int FXNJSONWriteFloat (char* buffer, size_t size, const char* format, double number) {
+    // JSON cannot represent NaN or infinity
+    if (!isfinite(number))
+        return snprintf(buffer, size, "null");
+    return snprintf(buffer, size, format, number);
+}
+
+static FXNStatus FXNJSONWriteElement (struct FXNJSONWriter* writer, FXNDtype type, const void* data, size_t index) {
+    char buffer[64];
+    int length = 0;
+    switch (type) {
+        case FXN_DTYPE_FLOAT16: length = FXNJSONWriteFloat(buffer, sizeof(buffer), "%.9g", (double)FXNJSONHalfToFloat(((const uint16_t*)data)[index])); break;
+        case FXN_DTYPE_FLOAT32: length = FXNJSONWriteFloat(buffer, sizeof(buffer), "%.9g", (double)((const float*)data)[index]); break;
+        case FXN_DTYPE_FLOAT64: length = FXNJSONWriteFloat(buffer, sizeof(buffer), "%.17g", ((const double*)data)[index]); break;
+        case FXN_DTYPE_INT8:    length = snprintf(buffer, sizeof(buffer), "%d", ((const int8_t*)data)[index]); break;
+        case FXN_DTYPE_INT16:   length = snprintf(buffer, sizeof(buffer), "%d", ((const int16_t*)data)[index]); break;
+        case FXN_DTYPE_INT32:   length = snprintf(buffer, sizeof(buffer), "%d", ((const int32_t*)data)[index]); break;
+        case FXN_DTYPE_INT64:   length = snprintf(buffer, sizeof(buffer), "%lld", (long long)((const int64_t*)data)[index]); break;
+        case FXN_DTYPE_UINT8:   length = snprintf(buffer, sizeof(buffer), "%u", ((const uint8_t*)data)[index]); break;
+        case FXN_DTYPE_UINT16:  length = snprintf(buffer, sizeof(buffer), "%u", ((const uint16_t*)data)[index]); break;
+        case FXN_DTYPE_UINT32:  length = snprintf(buffer, sizeof(buffer), "%u", ((const uint32_t*)data)[index]); break;
+        case FXN_DTYPE_UINT64:  length = snprintf(buffer, sizeof(buffer), "%llu", (unsigned long long)((const uint64_t*)data)[index]); break;
+        case FXN_DTYPE_BOOL:    length = snprintf(buffer, sizeof(buffer), "%s", ((const bool*)data)[index] ? "true" : "false"); break;
+        default:                return FXN_ERROR_INVALID_OPERATION;
+    }
+    FXNJSONWrite(writer, buffer, (size_t)length);
+    return FXN_OK;
+}
+
+static FXNStatus FXNJSONWriteTensor (struct FXNJSONWriter* writer, FXNValue* value, int32_t axis, size_t* index) {
+    if (axis == value->dims)
+        return FXNJSONWriteElement(writer, value->type, value->data, (*index)++);
+    FXNJSONWrite(writer, "[", 1);
+    for (int32_t i = 0; i < value->shape[axis]; ++i) {
+        if (i > 0)
+            FXNJSONWrite(writer, ",", 1);
+        FXNStatus status = FXNJSONWriteTensor(writer, value, axis + 1, index);
+        if (status != FXN_OK)
+            return status;
+    }
+    FXNJSONWrite(writer, "]", 1);
+    return FXN_OK;
+}
+
+static FXNStatus FXNJSONWriteValue (struct FXNJSONWriter* writer, FXNValue* value) {
+    switch (value->type) {
+        case FXN_DTYPE_NULL:
+            FXNJSONWrite(writer, "null", 4);
+            return FXN_OK;
+        case FXN_DTYPE_STRING:
+            FXNJSONWriteString(writer, (const char*)value->data);
+            return FXN_OK;
+        case FXN_DTYPE_LIST:
+        case FXN_DTYPE_DICT:
+            // Unstructured values already hold their JSON encoding
+            if (!value->items && !value->map) {
+                FXNJSONWrite(writer, (const char*)value->data, strlen((const char*)value->data));
+                return FXN_OK;
+            }
+            if (value->type == FXN_DTYPE_LIST) {
+                FXNJSONWrite(writer, "[", 1);
+                for (int32_t i = 0; i < value->count; ++i) {
+                    if (i > 0)
+                        FXNJSONWrite(writer, ",", 1);
+                    FXNStatus status = FXNJSONWriteValue(writer, value->items[i]);
+                    if (status != FXN_OK)
+                        return status;
+                }
+                FXNJSONWrite(writer, "]", 1);
+                return FXN_OK;
+            }
+            FXNJSONWrite(writer, "{", 1);
+            for (int32_t i = 0; i < value->map->size; ++i) {
+                if (i > 0)
+                    FXNJSONWrite(writer, ",", 1);
+                FXNJSONWriteString(writer, value->map->entries[i].key);
+                FXNJSONWrite(writer, ":", 1);
+                FXNStatus status = FXNJSONWriteValue(writer, value->map->entries[i].value);
+                if (status != FXN_OK)
+                    return status;
+            }
+            FXNJSONWrite(writer, "}", 1);
+            return FXN_OK;
+        case FXN_DTYPE_IMAGE:
+        case FXN_DTYPE_BINARY:
+            return FXN_ERROR_INVALID_OPERATION;
+        default: {
+            size_t index = 0;
+            return FXNJSONWriteTensor(writer, value, 0, &index);
+        }
+    }
+}
+
+FXNStatus FXNMockEncodeJSON (FXNValue* value, char** json, size_t* size) {
+    if (!value || !json)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    struct FXNJSONWriter writer = { 0 };
+    FXNStatus status = FXNJSONWriteValue(&writer, value);
+    if (status == FXN_OK && writer.failed)
+        status = FXN_ERROR_INVALID_OPERATION;
+    if (status != FXN_OK) {
+        free(writer.data);
+        return status;
+    }
+    *json = writer.data;
+    if (size)
+        *size = writer.size + 1;
+    return FXN_OK;
+}
+#pragma endregion
@@ -0,0 +1,590 @@
+//
+//  FXNMock.c
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include "FXNMock.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#pragma region --Hashing--
+static const uint64_t FXN_PRIME64_1 = 0x9E3779B185EBCA87ULL;
+static const uint64_t FXN_PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+static const uint64_t FXN_PRIME64_3 = 0x165667B19E3779F9ULL;
+static const uint64_t FXN_PRIME64_4 = 0x85EBCA77C2B2CA63ULL;
+static const uint64_t FXN_PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+static inline uint64_t FXNRotateLeft (uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t FXNRead64 (const uint8_t* p) {
+    uint64_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static inline uint32_t FXNRead32 (const uint8_t* p) {
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static inline uint64_t FXNHashRound (uint64_t acc, uint64_t input) {
+    acc += input * FXN_PRIME64_2;
+    acc = FXNRotateLeft(acc, 31);
+    return acc * FXN_PRIME64_1;
+}
+
+static inline uint64_t FXNHashMerge (uint64_t acc, uint64_t value) {
+    acc ^= FXNHashRound(0, value);
+    return acc * FXN_PRIME64_1 + FXN_PRIME64_4;
+}
+
+uint64_t FXNMockHash (const void* data, size_t size, uint64_t seed) {
+    const uint8_t* p = (const uint8_t*)data;
+    const uint8_t* const end = p + size;
+    uint64_t hash;
+    if (size >= 32) {
+        uint64_t v1 = seed + FXN_PRIME64_1 + FXN_PRIME64_2;
+        uint64_t v2 = seed + FXN_PRIME64_2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - FXN_PRIME64_1;
+        const uint8_t* const limit = end - 32;
+        do {
+            v1 = FXNHashRound(v1, FXNRead64(p));
+            v2 = FXNHashRound(v2, FXNRead64(p + 8));
+            v3 = FXNHashRound(v3, FXNRead64(p + 16));
+            v4 = FXNHashRound(v4, FXNRead64(p + 24));
+            p += 32;
+        } while (p <= limit);
+        hash = FXNRotateLeft(v1, 1) + FXNRotateLeft(v2, 7) + FXNRotateLeft(v3, 12) + FXNRotateLeft(v4, 18);
+        hash = FXNHashMerge(hash, v1);
+        hash = FXNHashMerge(hash, v2);
+        hash = FXNHashMerge(hash, v3);
+        hash = FXNHashMerge(hash, v4);
+    } else
+        hash = seed + FXN_PRIME64_5;
+    hash += (uint64_t)size;
+    for (; p + 8 <= end; p += 8) {
+        hash ^= FXNHashRound(0, FXNRead64(p));
+        hash = FXNRotateLeft(hash, 27) * FXN_PRIME64_1 + FXN_PRIME64_4;
+    }
+    if (p + 4 <= end) {
+        hash ^= (uint64_t)FXNRead32(p) * FXN_PRIME64_1;
+        hash = FXNRotateLeft(hash, 23) * FXN_PRIME64_2 + FXN_PRIME64_3;
+        p += 4;
+    }
+    for (; p < end; ++p) {
+        hash ^= (uint64_t)(*p) * FXN_PRIME64_5;
+        hash = FXNRotateLeft(hash, 11) * FXN_PRIME64_1;
+    }
+    hash ^= hash >> 33;
+    hash *= FXN_PRIME64_2;
+    hash ^= hash >> 29;
+    hash *= FXN_PRIME64_3;
+    hash ^= hash >> 32;
+    return hash;
+}
+#pragma endregion
+
+
+#pragma region --Time--
+double FXNMockGetTime (void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec * 1e3 + (double)now.tv_nsec * 1e-6;
+}
+
+void FXNMockSleep (int64_t duration) {
+    if (duration <= 0)
+        return;
+    struct timespec request = { .tv_sec = duration / 1000000, .tv_nsec = (duration % 1000000) * 1000 };
+    while (nanosleep(&request, &request) != 0);
+}
+#pragma endregion
+
+
+#pragma region --Strings--
+FXNStatus FXNMockCopyString (const char* source, char* destination, int32_t size) {
+    if (!destination || size <= 0)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    if (!source)
+        source = "";
+    size_t length = strlen(source);
+    if (length >= (size_t)size)
+        length = (size_t)size - 1;
+    memcpy(destination, source, length);
+    destination[length] = '\0';
+    return FXN_OK;
+}
+
+char* FXNMockDuplicateString (const char* source) {
+    if (!source)
+        return NULL;
+    size_t size = strlen(source) + 1;
+    char* result = malloc(size);
+    if (result)
+        memcpy(result, source, size);
+    return result;
+}
+#pragma endregion
+
+
+#pragma region --Files--
+FXNStatus FXNMockMapFile (const char* path, struct FXNMockMapping** mapping) {
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        close(fd);
+        return FXN_ERROR_INVALID_ARGUMENT;
+    }
+    const size_t size = (size_t)info.st_size;
+    void* data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    struct FXNMockMapping* result = malloc(sizeof(struct FXNMockMapping));
+    if (!result) {
+        munmap(data, size);
+        return FXN_ERROR_INVALID_OPERATION;
+    }
+    atomic_init(&result->references, 1);
+    result->data = data;
+    result->size = size;
+    *mapping = result;
+    return FXN_OK;
+}
+
+struct FXNMockMapping* FXNMockRetainMapping (struct FXNMockMapping* mapping) {
+    atomic_fetch_add(&mapping->references, 1);
+    return mapping;
+}
+
+void FXNMockReleaseMapping (struct FXNMockMapping* mapping) {
+    if (!mapping || atomic_fetch_sub(&mapping->references, 1) != 1)
+        return;
+    munmap(mapping->data, mapping->size);
+    free(mapping);
+}
+
+FXNStatus FXNMockCopyResource (const struct FXNMockResource* source, struct FXNMockResource* destination) {
+    *destination = (struct FXNMockResource) {
+        .type = FXNMockDuplicateString(source->type),
+        .path = FXNMockDuplicateString(source->path),
+        .offset = source->offset,
+        .size = source->size
+    };
+    if (!destination->type || !destination->path) {
+        FXNMockReleaseResource(destination);
+        return FXN_ERROR_INVALID_OPERATION;
+    }
+    if (source->mapping)
+        destination->mapping = FXNMockRetainMapping(source->mapping);
+    return FXN_OK;
+}
+
+FXNStatus FXNMockLoadResource (struct FXNMockResource* resource) {
+    if (!resource->mapping) {
+        FXNStatus status = FXNMockMapFile(resource->path, &resource->mapping);
+        if (status != FXN_OK)
+            return status;
+    }
+    const uint64_t size = resource->mapping->size;
+    if (resource->offset > size || resource->size > size - resource->offset)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    if (resource->size == 0)
+        resource->size = size - resource->offset;
+    // Reading the data faults it in, so predictions never wait on the disk
+    resource->checksum = FXNMockHash((const uint8_t*)resource->mapping->data + resource->offset, resource->size, 0);
+    return FXN_OK;
+}
+
+void FXNMockReleaseResource (struct FXNMockResource* resource) {
+    free(resource->type);
+    free(resource->path);
+    FXNMockReleaseMapping(resource->mapping);
+    *resource = (struct FXNMockResource) { 0 };
+}
+#pragma endregion
+
+
+#pragma region --Shared Memory--
+void* FXNMockMapSharedMemory (char** name, size_t size, bool create) {
+    static atomic_uint_fast64_t counter = 0;
+    const size_t length = size > 0 ? size : 1;
+    int fd = -1;
+    if (create) {
+        char buffer[64];
+        snprintf(buffer, sizeof(buffer), "/fxn-%d-%llu", (int)getpid(), (unsigned long long)atomic_fetch_add(&counter, 1));
+        fd = shm_open(buffer, O_RDWR | O_CREAT | O_EXCL, 0600);
+        if (fd < 0)
+            return NULL;
+        if (ftruncate(fd, (off_t)length) != 0) {
+            close(fd);
+            shm_unlink(buffer);
+            return NULL;
+        }
+        *name = FXNMockDuplicateString(buffer);
+        if (!*name) {
+            close(fd);
+            shm_unlink(buffer);
+            return NULL;
+        }
+    } else {
+        struct stat info;
+        fd = shm_open(*name, O_RDWR, 0);
+        if (fd < 0)
+            return NULL;
+        if (fstat(fd, &info) != 0 || (size_t)info.st_size < length) {
+            close(fd);
+            return NULL;
+        }
+    }
+    void* data = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        if (create) {
+            shm_unlink(*name);
+            free(*name);
+            *name = NULL;
+        }
+        return NULL;
+    }
+    return data;
+}
+
+FXNStatus FXNMockShareValueMap (FXNValueMap* map) {
+    for (int32_t i = 0; i < map->size; ++i) {
+        FXNValue* value = map->entries[i].value;
+        switch (value->type) {
+            case FXN_DTYPE_NULL:
+            case FXN_DTYPE_STRING:
+            case FXN_DTYPE_LIST:
+            case FXN_DTYPE_DICT:
+                continue;
+            default:
+                break;
+        }
+        if (value->sharedMemory)
+            continue;
+        char* name = NULL;
+        void* data = FXNMockMapSharedMemory(&name, value->size, true);
+        if (!data)
+            return FXN_ERROR_INVALID_OPERATION;
+        memcpy(data, value->data, value->size);
+        if (value->owner)
+            free(value->data);
+        value->data = data;
+        value->owner = false;
+        value->sharedMemory = name;
+        value->sharedMemoryOwner = true;
+    }
+    return FXN_OK;
+}
+#pragma endregion
+
+
+#pragma region --Values--
+FXNStatus FXNMockCopyValue (FXNValue* value, FXNValue** copy) {
+    if (!value || !copy)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    FXNValue* result = calloc(1, sizeof(FXNValue));
+    if (!result)
+        return FXN_ERROR_INVALID_OPERATION;
+    *result = *value;
+    result->owner = true;
+    result->shape = NULL;
+    result->data = NULL;
+    result->items = NULL;
+    result->count = 0;
+    result->map = NULL;
+    result->sharedMemory = NULL;
+    result->sharedMemoryOwner = false;
+    FXNStatus status = FXN_OK;
+    if (value->items) {
+        result->items = malloc(sizeof(FXNValue*) * (size_t)(value->count > 0 ? value->count : 1));
+        status = result->items ? FXN_OK : FXN_ERROR_INVALID_OPERATION;
+        for (int32_t i = 0; status == FXN_OK && i < value->count; ++i) {
+            status = FXNMockCopyValue(value->items[i], &result->items[result->count]);
+            if (status == FXN_OK)
+                ++result->count;
+        }
+    }
+    if (status == FXN_OK && value->map)
+        status = FXNMockCopyValueMap(value->map, &result->map);
+    if (status == FXN_OK && value->dims > 0) {
+        result->shape = malloc(sizeof(int32_t) * (size_t)value->dims);
+        if (result->shape)
+            memcpy(result->shape, value->shape, sizeof(int32_t) * (size_t)value->dims);
+        else
+            status = FXN_ERROR_INVALID_OPERATION;
+    }
+    if (status == FXN_OK && value->data) {
+        result->data = malloc(value->size > 0 ? value->size : 1);
+        if (result->data)
+            memcpy(result->data, value->data, value->size);
+        else
+            status = FXN_ERROR_INVALID_OPERATION;
+    }
+    if (status != FXN_OK) {
+        FXNValueRelease(result);
+        return status;
+    }
+    *copy = result;
+    return FXN_OK;
+}
+
+FXNStatus FXNMockCopyValueMap (FXNValueMap* map, FXNValueMap** copy) {
+    if (!map || !copy)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    FXNValueMap* result = NULL;
+    FXNStatus status = FXNValueMapCreate(&result);
+    for (int32_t i = 0; status == FXN_OK && i < map->size; ++i) {
+        FXNValue* value = NULL;
+        status = FXNMockCopyValue(map->entries[i].value, &value);
+        if (status == FXN_OK)
+            status = FXNValueMapSetValue(result, map->entries[i].key, value);
+        if (status != FXN_OK && value)
+            FXNValueRelease(value);
+    }
+    if (status != FXN_OK) {
+        FXNValueMapRelease(result);
+        return status;
+    }
+    *copy = result;
+    return FXN_OK;
+}
+
+static uint64_t FXNMockHashEntries (FXNValueMap* map, uint64_t hash);
+static bool FXNMockCompareEntries (FXNValueMap* a, FXNValueMap* b);
+
+static uint64_t FXNMockHashValue (FXNValue* value, uint64_t hash) {
+    hash = FXNMockHash(&value->type, sizeof(value->type), hash);
+    hash = FXNMockHash(value->shape, sizeof(int32_t) * (size_t)value->dims, hash);
+    // Structured values are hashed by their items, which can be modified in place
+    if (value->items) {
+        hash = FXNMockHash(&value->count, sizeof(value->count), hash);
+        for (int32_t i = 0; i < value->count; ++i)
+            hash = FXNMockHashValue(value->items[i], hash);
+        return hash;
+    }
+    if (value->map)
+        return FXNMockHashEntries(value->map, hash);
+    return FXNMockHash(value->data, value->data ? value->size : 0, hash);
+}
+
+static uint64_t FXNMockHashEntries (FXNValueMap* map, uint64_t hash) {
+    hash = FXNMockHash(&map->size, sizeof(map->size), hash);
+    for (int32_t i = 0; i < map->size; ++i) {
+        hash = FXNMockHash(map->entries[i].key, strlen(map->entries[i].key), hash);
+        hash = FXNMockHashValue(map->entries[i].value, hash);
+    }
+    return hash;
+}
+
+static bool FXNMockCompareValue (FXNValue* x, FXNValue* y) {
+    if (
+        x->type != y->type ||
+        x->dims != y->dims ||
+        !x->items != !y->items ||
+        !x->map != !y->map
+    )
+        return false;
+    if (x->dims > 0 && memcmp(x->shape, y->shape, sizeof(int32_t) * (size_t)x->dims) != 0)
+        return false;
+    if (x->items) {
+        if (x->count != y->count)
+            return false;
+        for (int32_t i = 0; i < x->count; ++i)
+            if (!FXNMockCompareValue(x->items[i], y->items[i]))
+                return false;
+        return true;
+    }
+    if (x->map)
+        return FXNMockCompareEntries(x->map, y->map);
+    if (x->size != y->size || !x->data != !y->data)
+        return false;
+    return !x->data || memcmp(x->data, y->data, x->size) == 0;
+}
+
+static bool FXNMockCompareEntries (FXNValueMap* a, FXNValueMap* b) {
+    if (a->size != b->size)
+        return false;
+    for (int32_t i = 0; i < a->size; ++i)
+        if (
+            strcmp(a->entries[i].key, b->entries[i].key) != 0 ||
+            !FXNMockCompareValue(a->entries[i].value, b->entries[i].value)
+        )
+            return false;
+    return true;
+}
+
+uint64_t FXNMockHashValueMap (FXNValueMap* map) {
+    FXNMockLockValues();
+    const uint64_t hash = FXNMockHashEntries(map, 0);
+    FXNMockUnlockValues();
+    return hash;
+}
+
+bool FXNMockCompareValueMap (FXNValueMap* a, FXNValueMap* b) {
+    FXNMockLockValues();
+    const bool equal = FXNMockCompareEntries(a, b);
+    FXNMockUnlockValues();
+    return equal;
+}
+
+FXNValueMap* FXNMockRetainValueMap (FXNValueMap* map) {
+    atomic_fetch_add(&map->references, 1);
+    return map;
+}
+
+static int64_t FXNMockGetEntriesSize (FXNValueMap* map);
+
+static int64_t FXNMockGetValueSize (FXNValue* value) {
+    // Structured values are sized by their items rather than their JSON encoding
+    int64_t size = value->items || value->map ? 0 : (int64_t)value->size;
+    for (int32_t i = 0; i < value->count; ++i)
+        size += FXNMockGetValueSize(value->items[i]);
+    if (value->map)
+        size += FXNMockGetEntriesSize(value->map);
+    return size;
+}
+
+static int64_t FXNMockGetEntriesSize (FXNValueMap* map) {
+    int64_t size = 0;
+    for (int32_t i = 0; i < map->size; ++i)
+        size += FXNMockGetValueSize(map->entries[i].value);
+    return size;
+}
+
+int64_t FXNMockGetValueMapSize (FXNValueMap* map) {
+    FXNMockLockValues();
+    const int64_t size = FXNMockGetEntriesSize(map);
+    FXNMockUnlockValues();
+    return size;
+}
+#pragma endregion
+
+
+#pragma region --Conversion--
+#define FXN_CONVERT(DST, SRC, EXPR) {                                   \
+    const SRC* input = source->data;                                    \
+    DST* output = destination->data;                                    \
+    for (size_t i = 0; i < count; ++i) {                                \
+        const SRC x = input[i];                                         \
+        output[i] = (DST)(EXPR);                                        \
+    }                                                                   \
+    break;                                                              \
+}
+
+#define FXN_CONVERT_FROM(DST)                                           \
+    switch (source->type) {                                             \
+        case FXN_DTYPE_FLOAT32: FXN_CONVERT(DST, float, x)              \
+        case FXN_DTYPE_FLOAT64: FXN_CONVERT(DST, double, x)             \
+        case FXN_DTYPE_INT8:    FXN_CONVERT(DST, int8_t, x)             \
+        case FXN_DTYPE_INT16:   FXN_CONVERT(DST, int16_t, x)            \
+        case FXN_DTYPE_INT32:   FXN_CONVERT(DST, int32_t, x)            \
+        case FXN_DTYPE_INT64:   FXN_CONVERT(DST, int64_t, x)            \
+        case FXN_DTYPE_UINT8:   FXN_CONVERT(DST, uint8_t, x)            \
+        case FXN_DTYPE_UINT16:  FXN_CONVERT(DST, uint16_t, x)           \
+        case FXN_DTYPE_UINT32:  FXN_CONVERT(DST, uint32_t, x)           \
+        case FXN_DTYPE_UINT64:  FXN_CONVERT(DST, uint64_t, x)           \
+        case FXN_DTYPE_BOOL:    FXN_CONVERT(DST, uint8_t, x != 0)       \
+        default:                break;                                  \
+    }                                                                   \
+    break;
+
+static bool FXNMockIsFloatingPoint (FXNDtype type) {
+    return type == FXN_DTYPE_FLOAT32 || type == FXN_DTYPE_FLOAT64;
+}
+
+static bool FXNMockIsInteger (FXNDtype type) {
+    return type >= FXN_DTYPE_INT8 && type <= FXN_DTYPE_BOOL;
+}
+
+static bool FXNMockConvertFast (FXNValue* source, FXNValue* destination, size_t count) {
+#if defined(__SSE2__)
+    size_t i = 0;
+    float* output = destination->data;
+    if (source->type == FXN_DTYPE_FLOAT64 && destination->type == FXN_DTYPE_FLOAT32) {
+        const double* input = source->data;
+        for (; i + 4 <= count; i += 4) {
+            const __m128 lo = _mm_cvtpd_ps(_mm_loadu_pd(input + i));
+            const __m128 hi = _mm_cvtpd_ps(_mm_loadu_pd(input + i + 2));
+            _mm_storeu_ps(output + i, _mm_movelh_ps(lo, hi));
+        }
+        for (; i < count; ++i)
+            output[i] = (float)input[i];
+        return true;
+    }
+    if (source->type == FXN_DTYPE_INT32 && destination->type == FXN_DTYPE_FLOAT32) {
+        const int32_t* input = source->data;
+        for (; i + 4 <= count; i += 4)
+            _mm_storeu_ps(output + i, _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i*)(input + i))));
+        for (; i < count; ++i)
+            output[i] = (float)input[i];
+        return true;
+    }
+#endif
+    (void)source;
+    (void)destination;
+    (void)count;
+    return false;
+}
+
+FXNStatus FXNMockConvertValue (FXNValue* value, FXNDtype type, FXNValue** result) {
+    if (!value || !result)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    if (value->type == type)
+        return FXNMockCopyValue(value, result);
+    // Floating point to integer conversions can overflow, so only widen to floating point or between integers
+    const bool convertible =
+        (FXNMockIsFloatingPoint(value->type) || FXNMockIsInteger(value->type)) &&
+        (FXNMockIsFloatingPoint(type) || (FXNMockIsInteger(type) && type != FXN_DTYPE_BOOL && FXNMockIsInteger(value->type)));
+    if (!convertible)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    FXNValue* destination = NULL;
+    FXNStatus status = FXNValueCreateArray(NULL, value->shape, value->dims, type, FXN_VALUE_FLAG_NONE, &destination);
+    if (status != FXN_OK)
+        return status;
+    FXNValue* source = value;
+    size_t count = 1;
+    for (int32_t i = 0; i < value->dims; ++i)
+        count *= (size_t)value->shape[i];
+    if (!FXNMockConvertFast(source, destination, count))
+        switch (type) {
+            case FXN_DTYPE_FLOAT32: FXN_CONVERT_FROM(float)
+            case FXN_DTYPE_FLOAT64: FXN_CONVERT_FROM(double)
+            case FXN_DTYPE_INT8:    FXN_CONVERT_FROM(int8_t)
+            case FXN_DTYPE_INT16:   FXN_CONVERT_FROM(int16_t)
+            case FXN_DTYPE_INT32:   FXN_CONVERT_FROM(int32_t)
+            case FXN_DTYPE_INT64:   FXN_CONVERT_FROM(int64_t)
+            case FXN_DTYPE_UINT8:   FXN_CONVERT_FROM(uint8_t)
+            case FXN_DTYPE_UINT16:  FXN_CONVERT_FROM(uint16_t)
+            case FXN_DTYPE_UINT32:  FXN_CONVERT_FROM(uint32_t)
+            case FXN_DTYPE_UINT64:  FXN_CONVERT_FROM(uint64_t)
+            default:                break;
+        }
+    *result = destination;
+    return FXN_OK;
+}
+
+#undef FXN_CONVERT_FROM
+#undef FXN_CONVERT
+#pragma endregion
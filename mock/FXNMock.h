@@ -0,0 +1,630 @@
+//
+//  FXNMock.h
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#pragma once
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <Function/Function.h>
+
+#pragma region --Types--
+/*!
+ @enum FXNMockKind
+
+ @abstract Synthetic predictor kind, selected by the predictor tag.
+
+ Duplex streams make one prediction for each input chunk written into the stream.
+
+ @constant FXN_MOCK_ECHO
+ `@mock/echo`: returns a copy of its inputs.
+
+ @constant FXN_MOCK_MATMUL
+ `@mock/matmul?size=N`: multiplies the `float32` input `a` with shape `(M,N)` by an `(N,N)` weight matrix,
+ returning `c` with shape `(M,N)`. Other numeric inputs are converted to `float32`.
+
+ @constant FXN_MOCK_SLEEP
+ `@mock/sleep?duration=N`: sleeps for `N` microseconds and returns no outputs.
+
+ @constant FXN_MOCK_TOKENS
+ `@mock/tokens?count=N&duration=D`: streams `N` predictions, each containing an `int32` scalar `token`
+ and a string `text`, sleeping for `D` microseconds per token.
+*/
+enum FXNMockKind {
+    FXN_MOCK_ECHO   = 0,
+    FXN_MOCK_MATMUL = 1,
+    FXN_MOCK_SLEEP  = 2,
+    FXN_MOCK_TOKENS = 3,
+};
+typedef enum FXNMockKind FXNMockKind;
+
+struct FXNValue {
+    FXNDtype type;
+    void* data;
+    int32_t* shape;
+    int32_t dims;
+    size_t size;
+    bool owner;
+    FXNValue** items;
+    int32_t count;
+    FXNValueMap* map;
+    char* sharedMemory;
+    bool sharedMemoryOwner;
+};
+
+struct FXNValueMapEntry {
+    char* key;
+    FXNValue* value;
+};
+
+struct FXNValueMap {
+    atomic_int references;
+    struct FXNValueMapEntry* entries;
+    int32_t size;
+    int32_t capacity;
+    FXNPredictor* preparedPredictor;
+    int64_t preparedVersion;
+};
+
+/*!
+ Read-only file mapping shared by the configurations and predictors which reference it.
+*/
+struct FXNMockMapping {
+    atomic_int references;
+    void* data;
+    size_t size;
+};
+
+/*!
+ Configuration resource. Bundle resources reference a section of the bundle mapping in place,
+ while other resources are mapped when a predictor is created.
+ A size of zero references the rest of the file from the offset.
+*/
+struct FXNMockResource {
+    char* type;
+    char* path;
+    struct FXNMockMapping* mapping;
+    uint64_t offset;
+    uint64_t size;
+    uint64_t checksum;
+};
+
+struct FXNConfiguration {
+    char* tag;
+    char* token;
+    FXNAcceleration acceleration;
+    void* device;
+    struct FXNMockResource* resources;
+    int32_t resourceCount;
+    struct FXNMockMapping* bundle;
+    FXNThreadPolicy threadPolicy;
+    int32_t intraOpThreads;
+    int32_t interOpThreads;
+    int32_t* affinity;
+    int32_t affinityCount;
+    int32_t numaNode;
+    FXNNUMAPolicy numaPolicy;
+    FXNPriority priority;
+    int32_t schedulingWeight;
+    int64_t resultCacheCapacity;
+    bool sharedMemoryOutputs;
+    char* recordingPath;
+};
+
+struct FXNPrediction {
+    char id[64];
+    double latency;
+    FXNValueMap* results;
+    char* error;
+    char* logs;
+};
+
+struct FXNPredictionStream {
+    FXNPredictor* predictor;
+    struct FXNMockModel* model;
+    FXNValueMap* inputs;
+    int32_t index;
+    int32_t count;
+    bool duplex;
+    bool closed;
+    bool released;
+    int32_t readers;
+    FXNValueMap** pending;
+    int32_t pendingCount;
+    int32_t pendingCapacity;
+    pthread_mutex_t lock;
+    pthread_cond_t ready;
+};
+
+struct FXNMockCacheEntry {
+    uint64_t hash;
+    FXNValueMap* inputs;
+    FXNValueMap* results;
+    int64_t size;
+    struct FXNMockCacheEntry* chain;
+    struct FXNMockCacheEntry* prev;
+    struct FXNMockCacheEntry* next;
+};
+
+#define FXN_MOCK_MAX_NUMA_NODES 64
+
+struct FXNMockModel {
+    atomic_int references;
+    int64_t version;
+    FXNMockKind kind;
+    int64_t size;
+    int64_t count;
+    int64_t duration;
+    struct FXNMockResource* resources;
+    int32_t resourceCount;
+    float* weights;
+    float* replicas[FXN_MOCK_MAX_NUMA_NODES];
+    FXNNUMAPolicy numaPolicy;
+    int32_t numaNode;
+    int64_t bytes;
+    int64_t lastUsed;
+};
+
+/*!
+ Scheduling state of a predictor on its executor, guarded by the executor lock.
+*/
+struct FXNMockSchedule {
+    FXNPriority priority;
+    int32_t weight;
+    uint64_t pass;
+    int32_t concurrency;
+    int32_t running;
+};
+
+struct FXNPredictor {
+    pthread_mutex_t modelLock;
+    struct FXNMockModel* model;
+    pthread_cond_t swapped;
+    int32_t swaps;
+    bool sharedMemoryOutputs;
+    struct FXNMockRecorder* recorder;
+    struct FXNMockExecutor* executor;
+    bool dedicated;
+    struct FXNMockSchedule schedule;
+    int32_t notifications;
+    pthread_mutex_t cacheLock;
+    int64_t cacheCapacity;
+    int64_t cacheSize;
+    int64_t cacheHits;
+    int64_t cacheMisses;
+    struct FXNMockCacheEntry** cacheBuckets;
+    int32_t cacheBucketCount;
+    int32_t cacheCount;
+    struct FXNMockCacheEntry* cacheHead;
+    struct FXNMockCacheEntry* cacheTail;
+};
+#pragma endregion
+
+
+#pragma region --Utilities--
+/*!
+ @function FXNMockHash
+
+ @abstract Compute the XXH64 hash of a buffer.
+*/
+uint64_t FXNMockHash (const void* data, size_t size, uint64_t seed);
+
+/*!
+ @function FXNMockGetTime
+
+ @abstract Get the current monotonic time in milliseconds.
+*/
+double FXNMockGetTime (void);
+
+/*!
+ @function FXNMockSleep
+
+ @abstract Sleep for a given number of microseconds.
+*/
+void FXNMockSleep (int64_t duration);
+
+/*!
+ @function FXNMockCopyString
+
+ @abstract Copy a string into a destination buffer, truncating it if necessary.
+*/
+FXNStatus FXNMockCopyString (const char* source, char* destination, int32_t size);
+
+/*!
+ @function FXNMockDuplicateString
+
+ @abstract Duplicate a string. Returns `NULL` if the source is `NULL`.
+*/
+char* FXNMockDuplicateString (const char* source);
+
+/*!
+ @function FXNMockCopyValue
+
+ @abstract Create a deep copy of a value.
+*/
+FXNStatus FXNMockCopyValue (FXNValue* value, FXNValue** copy);
+
+/*!
+ @function FXNMockCopyValueMap
+
+ @abstract Create a deep copy of a value map.
+*/
+FXNStatus FXNMockCopyValueMap (FXNValueMap* map, FXNValueMap** copy);
+
+/*!
+ @function FXNMockConvertValue
+
+ @abstract Convert a tensor value to a given data type.
+ Floating point values cannot be converted to integers.
+*/
+FXNStatus FXNMockConvertValue (FXNValue* value, FXNDtype type, FXNValue** result);
+
+/*!
+ @function FXNMockLockValues
+
+ @abstract Acquire the lock which serializes lazy decoding and encoding of structured values.
+ Structured values are lazily mutated by accessors, and can be shared across threads by the result cache.
+*/
+void FXNMockLockValues (void);
+
+/*!
+ @function FXNMockUnlockValues
+
+ @abstract Release the lock acquired with `FXNMockLockValues`.
+*/
+void FXNMockUnlockValues (void);
+
+/*!
+ @function FXNMockDecodeJSON
+
+ @abstract Decode a JSON document into a structured value.
+*/
+FXNStatus FXNMockDecodeJSON (const char* json, FXNValue** value);
+
+/*!
+ @function FXNMockEncodeJSON
+
+ @abstract Encode a value as JSON.
+ The size includes the null terminator.
+*/
+FXNStatus FXNMockEncodeJSON (FXNValue* value, char** json, size_t* size);
+
+/*!
+ @function FXNMockMapSharedMemory
+
+ @abstract Map a named shared memory region.
+ When `create` is set, a new region of `size` bytes is created and its name is returned in `name`.
+ Otherwise the existing region `name` is mapped, and must be at least `size` bytes.
+*/
+void* FXNMockMapSharedMemory (char** name, size_t size, bool create);
+
+/*!
+ @function FXNMockMapFile
+
+ @abstract Map a file read-only, returning a mapping with a single reference.
+*/
+FXNStatus FXNMockMapFile (const char* path, struct FXNMockMapping** mapping);
+
+/*!
+ @function FXNMockRetainMapping
+
+ @abstract Acquire a reference to a file mapping.
+*/
+struct FXNMockMapping* FXNMockRetainMapping (struct FXNMockMapping* mapping);
+
+/*!
+ @function FXNMockReleaseMapping
+
+ @abstract Release a reference to a file mapping, unmapping the file once it is no longer referenced.
+*/
+void FXNMockReleaseMapping (struct FXNMockMapping* mapping);
+
+/*!
+ @function FXNMockCopyResource
+
+ @abstract Copy a resource, sharing its mapping.
+*/
+FXNStatus FXNMockCopyResource (const struct FXNMockResource* source, struct FXNMockResource* destination);
+
+/*!
+ @function FXNMockLoadResource
+
+ @abstract Map a resource if it is not already mapped, then read and checksum its data.
+*/
+FXNStatus FXNMockLoadResource (struct FXNMockResource* resource);
+
+/*!
+ @function FXNMockReleaseResource
+
+ @abstract Release the strings and mapping of a resource.
+*/
+void FXNMockReleaseResource (struct FXNMockResource* resource);
+
+/*!
+ @function FXNMockShareValueMap
+
+ @abstract Move the data of every tensor value in a value map into shared memory.
+*/
+FXNStatus FXNMockShareValueMap (FXNValueMap* map);
+
+/*!
+ @function FXNMockCreateRecorder
+
+ @abstract Create a prediction recorder which writes to a given path.
+*/
+FXNStatus FXNMockCreateRecorder (const char* path, struct FXNMockRecorder** recorder);
+
+/*!
+ @function FXNMockReleaseRecorder
+
+ @abstract Flush and release a prediction recorder.
+*/
+void FXNMockReleaseRecorder (struct FXNMockRecorder* recorder);
+
+/*!
+ @function FXNMockRecordPrediction
+
+ @abstract Append a prediction to a recording.
+*/
+void FXNMockRecordPrediction (struct FXNMockRecorder* recorder, FXNValueMap* inputs, double start, double latency);
+
+/*!
+ @function FXNMockHashValueMap
+
+ @abstract Hash the keys, types, shapes, and data of the values in a value map.
+ List and dictionary values are hashed by their items, without encoding them to JSON.
+*/
+uint64_t FXNMockHashValueMap (FXNValueMap* map);
+
+/*!
+ @function FXNMockCompareValueMap
+
+ @abstract Check whether two value maps have equal keys, types, shapes, and data.
+*/
+bool FXNMockCompareValueMap (FXNValueMap* a, FXNValueMap* b);
+
+/*!
+ @function FXNMockRetainValueMap
+
+ @abstract Acquire a reference to a value map.
+ The value map is only destroyed once every reference has been released with `FXNValueMapRelease`.
+*/
+FXNValueMap* FXNMockRetainValueMap (FXNValueMap* map);
+
+/*!
+ @function FXNMockGetValueMapSize
+
+ @abstract Get the total data size in bytes of the values in a value map, including list and dictionary items.
+*/
+int64_t FXNMockGetValueMapSize (FXNValueMap* map);
+
+/*!
+ @function FXNMockAcquireModel
+
+ @abstract Acquire a reference to the current model of a predictor.
+ The model remains valid until released, even if the predictor swaps to a new model.
+*/
+struct FXNMockModel* FXNMockAcquireModel (FXNPredictor* predictor);
+
+/*!
+ @function FXNMockReleaseModel
+
+ @abstract Release a reference to a predictor model, freeing the model once it is no longer in use.
+*/
+void FXNMockReleaseModel (struct FXNMockModel* model);
+
+/*!
+ @function FXNMockLoadModel
+
+ @abstract Load the weights of a predictor model.
+*/
+FXNStatus FXNMockLoadModel (struct FXNMockModel* model);
+
+/*!
+ @function FXNMockUnloadModel
+
+ @abstract Free the weights of a predictor model, including any NUMA replicas.
+*/
+void FXNMockUnloadModel (struct FXNMockModel* model);
+
+/*!
+ @function FXNMockGetWeights
+
+ @abstract Get the weights of a predictor model to read from the calling thread.
+ Replicated weights resolve to the replica on the NUMA node of the calling thread.
+*/
+const float* FXNMockGetWeights (struct FXNMockModel* model);
+
+/*!
+ @function FXNMockRegisterPredictor
+
+ @abstract Register a loaded predictor with the process-wide memory budget.
+*/
+void FXNMockRegisterPredictor (FXNPredictor* predictor);
+
+/*!
+ @function FXNMockUnregisterPredictor
+
+ @abstract Unregister a predictor from the process-wide memory budget.
+ Waits for residency notifications of the predictor to complete,
+ and fails when called from a residency handler while the predictor has pending notifications.
+*/
+FXNStatus FXNMockUnregisterPredictor (FXNPredictor* predictor);
+
+/*!
+ @function FXNMockReplaceModel
+
+ @abstract Replace the current model of a registered predictor, returning the previous model.
+*/
+struct FXNMockModel* FXNMockReplaceModel (FXNPredictor* predictor, struct FXNMockModel* model);
+
+/*!
+ @function FXNMockMakeResident
+
+ @abstract Mark a predictor model as used, reloading its weights if they were evicted.
+*/
+FXNStatus FXNMockMakeResident (FXNPredictor* predictor, struct FXNMockModel* model);
+
+/*!
+ @function FXNMockPredict
+
+ @abstract Make a prediction with a given predictor model.
+*/
+FXNStatus FXNMockPredict (
+    FXNPredictor* predictor,
+    struct FXNMockModel* model,
+    FXNValueMap* inputs,
+    FXNPrediction** prediction
+);
+
+/*!
+ @function FXNMockBindInputs
+
+ @abstract Validate prediction inputs against the signature of a predictor model.
+ When `copy` is set, or when tensors must be converted, `bound` receives a copy of the inputs
+ with tensors converted to the signature data types. Signature mismatches are reported in `error`.
+*/
+FXNStatus FXNMockBindInputs (
+    struct FXNMockModel* model,
+    FXNValueMap* inputs,
+    bool copy,
+    FXNValueMap** bound,
+    const char** error
+);
+
+/*!
+ @function FXNMockRun
+
+ @abstract Run a predictor model on validated inputs, creating a new results map.
+ The model runs on the executor of the predictor.
+*/
+FXNStatus FXNMockRun (
+    FXNPredictor* predictor,
+    struct FXNMockModel* model,
+    FXNValueMap* inputs,
+    FXNValueMap** results,
+    const char** error
+);
+
+/*!
+ @function FXNMockMatmul
+
+ @abstract Multiply an `(M,N)` matrix by the weights of a matmul predictor model, overwriting `out`.
+ Rows are split across the executor of the predictor.
+*/
+void FXNMockMatmul (
+    FXNPredictor* predictor,
+    struct FXNMockModel* model,
+    const float* lhs,
+    float* out,
+    int64_t m
+);
+
+/*!
+ @function FXNMockGenerateTokens
+
+ @abstract Generate the tokens of a tokens predictor model, overwriting `tokens`.
+*/
+void FXNMockGenerateTokens (struct FXNMockModel* model, int32_t* tokens);
+
+/*!
+ @function FXNMockCreatePrediction
+
+ @abstract Create a prediction which takes ownership of a results map.
+*/
+FXNStatus FXNMockCreatePrediction (FXNValueMap* results, double latency, FXNPrediction** prediction);
+
+/*!
+ @function FXNMockCreateExecutor
+
+ @abstract Create a pool of worker threads.
+ Workers are pinned to the intersection of the `affinity` cores and the cores of NUMA node `node`,
+ ignoring either when empty or negative. Zero threads creates one worker per pinned core,
+ or per logical CPU core when unpinned.
+*/
+FXNStatus FXNMockCreateExecutor (
+    int32_t threads,
+    const int32_t* affinity,
+    int32_t affinityCount,
+    int32_t node,
+    struct FXNMockExecutor** executor
+);
+
+/*!
+ @function FXNMockReleaseExecutor
+
+ @abstract Release a pool of worker threads, waiting for queued work to complete.
+*/
+void FXNMockReleaseExecutor (struct FXNMockExecutor* executor);
+
+/*!
+ @function FXNMockGetSharedExecutor
+
+ @abstract Get the process-wide executor, starting it on first use.
+*/
+FXNStatus FXNMockGetSharedExecutor (struct FXNMockExecutor** executor);
+
+/*!
+ @function FXNMockGetExecutorThreadCount
+
+ @abstract Get the number of worker threads in an executor.
+ Returns `1` for a `NULL` executor, which runs work on the calling thread.
+*/
+int32_t FXNMockGetExecutorThreadCount (struct FXNMockExecutor* executor);
+
+/*!
+ @function FXNMockGetBackgroundExecutor
+
+ @abstract Get the process-wide executor which loads models in the background, starting it on first use.
+*/
+FXNStatus FXNMockGetBackgroundExecutor (struct FXNMockExecutor** executor);
+
+/*!
+ @function FXNMockExecute
+
+ @abstract Run `function` for every index in `[0, count)` on an executor.
+ Blocks until every index has completed. Work runs on the calling thread when the executor is `NULL`,
+ or when the calling thread is one of its workers.
+*/
+void FXNMockExecute (
+    struct FXNMockExecutor* executor,
+    struct FXNMockSchedule* schedule,
+    int64_t count,
+    void (*function) (void* context, int64_t index),
+    void* context
+);
+
+/*!
+ @function FXNMockExecuteAsync
+
+ @abstract Run `function` for every index in `[0, count)` on an executor without blocking.
+ Once every index has completed, `completion` is invoked on the worker thread which ran the last index.
+*/
+FXNStatus FXNMockExecuteAsync (
+    struct FXNMockExecutor* executor,
+    struct FXNMockSchedule* schedule,
+    int64_t count,
+    void (*function) (void* context, int64_t index),
+    void (*completion) (void* context),
+    void* context
+);
+
+/*!
+ @function FXNMockParallelFor
+
+ @abstract Run `function` for every index in `[0, count)` on the executor of a predictor.
+ Blocks until every index has completed. Work runs on the calling thread when the predictor has no executor.
+*/
+void FXNMockParallelFor (
+    FXNPredictor* predictor,
+    int64_t count,
+    void (*function) (void* context, int64_t index),
+    void* context
+);
+#pragma endregion
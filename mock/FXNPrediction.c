@@ -0,0 +1,87 @@
+//
+//  FXNPrediction.c
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FXNMock.h"
+
+static atomic_llong FXNPredictionCount = 0;
+
+FXNStatus FXNMockCreatePrediction (FXNValueMap* results, double latency, FXNPrediction** prediction) {
+    if (!prediction)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    FXNPrediction* result = calloc(1, sizeof(FXNPrediction));
+    if (!result)
+        return FXN_ERROR_INVALID_OPERATION;
+    snprintf(result->id, sizeof(result->id), "mock-%lld", (long long)atomic_fetch_add(&FXNPredictionCount, 1));
+    result->latency = latency;
+    result->results = results;
+    *prediction = result;
+    return FXN_OK;
+}
+
+#pragma region --Lifecycle--
+FXNStatus FXNPredictionRelease (FXNPrediction* prediction) {
+    if (!prediction)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    if (prediction->results)
+        FXNValueMapRelease(prediction->results);
+    free(prediction->error);
+    free(prediction->logs);
+    free(prediction);
+    return FXN_OK;
+}
+#pragma endregion
+
+
+#pragma region --Operations--
+FXNStatus FXNPredictionGetID (FXNPrediction* prediction, char* destination, int32_t size) {
+    if (!prediction)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    return FXNMockCopyString(prediction->id, destination, size);
+}
+
+FXNStatus FXNPredictionGetLatency (FXNPrediction* prediction, double* latency) {
+    if (!prediction || !latency)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    *latency = prediction->latency;
+    return FXN_OK;
+}
+
+FXNStatus FXNPredictionGetResults (FXNPrediction* prediction, FXNValueMap** map) {
+    if (!prediction || !map)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    if (!prediction->results)
+        return FXN_ERROR_INVALID_OPERATION;
+    *map = prediction->results;
+    return FXN_OK;
+}
+
+FXNStatus FXNPredictionGetError (FXNPrediction* prediction, char* error, int32_t size) {
+    if (!prediction)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    if (!prediction->error)
+        return FXN_ERROR_INVALID_OPERATION;
+    return FXNMockCopyString(prediction->error, error, size);
+}
+
+FXNStatus FXNPredictionGetLogs (FXNPrediction* prediction, char* logs, int32_t size) {
+    if (!prediction)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    return FXNMockCopyString(prediction->logs, logs, size);
+}
+
+FXNStatus FXNPredictionGetLogLength (FXNPrediction* prediction, int32_t* length) {
+    if (!prediction || !length)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    *length = prediction->logs ? (int32_t)strlen(prediction->logs) : 0;
+    return FXN_OK;
+}
+
+#pragma endregion
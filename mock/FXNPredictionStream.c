@@ -0,0 +1,169 @@
+//
+//  FXNPredictionStream.c
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FXNMock.h"
+
+#pragma region --Lifecycle--
+FXNStatus FXNPredictionStreamRelease (FXNPredictionStream* stream) {
+    if (!stream)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    // Fail blocked readers and wait for in-flight reads to return
+    if (stream->duplex) {
+        pthread_mutex_lock(&stream->lock);
+        stream->released = true;
+        pthread_cond_broadcast(&stream->ready);
+        while (stream->readers > 0)
+            pthread_cond_wait(&stream->ready, &stream->lock);
+        pthread_mutex_unlock(&stream->lock);
+    }
+    if (stream->inputs)
+        FXNValueMapRelease(stream->inputs);
+    if (stream->model)
+        FXNMockReleaseModel(stream->model);
+    if (stream->duplex) {
+        for (int32_t i = 0; i < stream->pendingCount; ++i)
+            FXNValueMapRelease(stream->pending[i]);
+        free(stream->pending);
+        pthread_cond_destroy(&stream->ready);
+        pthread_mutex_destroy(&stream->lock);
+    }
+    free(stream);
+    return FXN_OK;
+}
+#pragma endregion
+
+
+#pragma region --Operations--
+static void FXNPredictionStreamGenerate (void* context, int64_t index) {
+    const struct FXNMockModel* model = context;
+    FXNMockSleep(model->duration);
+}
+
+static FXNStatus FXNPredictionStreamReadNextDuplex (FXNPredictionStream* stream, FXNPrediction** prediction) {
+    // Wait for the next input chunk
+    pthread_mutex_lock(&stream->lock);
+    ++stream->readers;
+    while (stream->pendingCount == 0 && !stream->closed && !stream->released)
+        pthread_cond_wait(&stream->ready, &stream->lock);
+    FXNValueMap* inputs = NULL;
+    if (stream->pendingCount > 0 && !stream->released) {
+        inputs = stream->pending[0];
+        memmove(stream->pending, stream->pending + 1, sizeof(FXNValueMap*) * (size_t)(--stream->pendingCount));
+    }
+    pthread_mutex_unlock(&stream->lock);
+    // Predict
+    FXNStatus status = FXN_ERROR_INVALID_OPERATION;
+    if (inputs) {
+        status = FXNMockPredict(stream->predictor, stream->model, inputs, prediction);
+        FXNValueMapRelease(inputs);
+    }
+    pthread_mutex_lock(&stream->lock);
+    if (--stream->readers == 0 && stream->released)
+        pthread_cond_broadcast(&stream->ready);
+    pthread_mutex_unlock(&stream->lock);
+    return status;
+}
+
+FXNStatus FXNPredictionStreamReadNext (FXNPredictionStream* stream, FXNPrediction** prediction) {
+    if (!stream || !prediction)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    if (stream->duplex)
+        return FXNPredictionStreamReadNextDuplex(stream, prediction);
+    if (stream->index >= stream->count)
+        return FXN_ERROR_INVALID_OPERATION;
+    FXNPredictor* predictor = stream->predictor;
+    // Non-generative predictors stream a single prediction
+    if (stream->model->kind != FXN_MOCK_TOKENS) {
+        ++stream->index;
+        return FXNMockPredict(predictor, stream->model, stream->inputs, prediction);
+    }
+    // Generate the next token
+    const double start = FXNMockGetTime();
+    FXNMockParallelFor(predictor, 1, FXNPredictionStreamGenerate, stream->model);
+    const int32_t index = stream->index++;
+    char text[32];
+    snprintf(text, sizeof(text), " token%d", index);
+    FXNValueMap* results = NULL;
+    FXNValue* token = NULL;
+    FXNValue* string = NULL;
+    FXNStatus status = FXNValueMapCreate(&results);
+    if (status == FXN_OK)
+        status = FXNValueCreateArray((void*)&index, NULL, 0, FXN_DTYPE_INT32, FXN_VALUE_FLAG_COPY_DATA, &token);
+    if (status == FXN_OK)
+        status = FXNValueCreateString(text, &string);
+    if (status == FXN_OK)
+        status = FXNValueMapSetValue(results, "token", token);
+    if (status == FXN_OK)
+        token = NULL;
+    if (status == FXN_OK)
+        status = FXNValueMapSetValue(results, "text", string);
+    if (status == FXN_OK)
+        string = NULL;
+    if (token)
+        FXNValueRelease(token);
+    if (string)
+        FXNValueRelease(string);
+    if (status == FXN_OK && predictor->sharedMemoryOutputs)
+        status = FXNMockShareValueMap(results);
+    if (status == FXN_OK)
+        status = FXNMockCreatePrediction(results, FXNMockGetTime() - start, prediction);
+    if (status != FXN_OK) {
+        if (results)
+            FXNValueMapRelease(results);
+        return status;
+    }
+    return FXN_OK;
+}
+
+FXNStatus FXNPredictionStreamWriteInputs (FXNPredictionStream* stream, FXNValueMap* inputs) {
+    if (!stream || !inputs)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    if (!stream->duplex)
+        return FXN_ERROR_INVALID_OPERATION;
+    FXNValueMap* chunk = NULL;
+    FXNStatus status = FXNMockCopyValueMap(inputs, &chunk);
+    if (status != FXN_OK)
+        return status;
+    pthread_mutex_lock(&stream->lock);
+    if (stream->closed) {
+        pthread_mutex_unlock(&stream->lock);
+        FXNValueMapRelease(chunk);
+        return FXN_ERROR_INVALID_OPERATION;
+    }
+    if (stream->pendingCount == stream->pendingCapacity) {
+        const int32_t capacity = stream->pendingCapacity > 0 ? 2 * stream->pendingCapacity : 8;
+        FXNValueMap** pending = realloc(stream->pending, sizeof(FXNValueMap*) * (size_t)capacity);
+        if (!pending) {
+            pthread_mutex_unlock(&stream->lock);
+            FXNValueMapRelease(chunk);
+            return FXN_ERROR_INVALID_OPERATION;
+        }
+        stream->pending = pending;
+        stream->pendingCapacity = capacity;
+    }
+    stream->pending[stream->pendingCount++] = chunk;
+    pthread_cond_signal(&stream->ready);
+    pthread_mutex_unlock(&stream->lock);
+    return FXN_OK;
+}
+
+FXNStatus FXNPredictionStreamCloseInputs (FXNPredictionStream* stream) {
+    if (!stream)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    if (!stream->duplex)
+        return FXN_ERROR_INVALID_OPERATION;
+    pthread_mutex_lock(&stream->lock);
+    stream->closed = true;
+    pthread_cond_broadcast(&stream->ready);
+    pthread_mutex_unlock(&stream->lock);
+    return FXN_OK;
+}
+#pragma endregion
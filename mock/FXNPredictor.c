@@ -0,0 +1,942 @@
+//
+//  FXNPredictor.c
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FXNMock.h"
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+// Memory policies from `linux/mempolicy.h`
+#define FXN_MPOL_BIND 2
+#define FXN_MPOL_INTERLEAVE 3
+#endif
+
+struct FXNPredictorMatmulTask {
+    struct FXNMockModel* model;
+    const float* lhs;
+    float* out;
+    int64_t m;
+    int64_t rows;
+};
+
+struct FXNPredictorRunTask {
+    struct FXNMockModel* model;
+    FXNValueMap* inputs;
+    FXNValueMap** results;
+    FXNStatus status;
+};
+
+struct FXNPredictorCreateTask {
+    FXNPredictor* predictor;
+    struct FXNMockModel* model;
+    atomic_int status;
+    FXNPredictorCreateHandler handler;
+    void* context;
+};
+
+static atomic_int_fast64_t FXNModelVersion = 0;
+
+// Depth of swap handlers on the calling thread, which cannot wait for their own swaps
+static _Thread_local int32_t FXNPredictorSwapDepth = 0;
+
+// Models load on the background executor, where they share workers in submission order
+static struct FXNMockSchedule FXNPredictorLoadSchedule = { .priority = FXN_PRIORITY_NORMAL, .weight = 1 };
+
+static int64_t FXNPredictorGetParameter (const char* tag, const char* name, int64_t fallback) {
+    const char* query = strchr(tag, '?');
+    const size_t length = strlen(name);
+    for (const char* p = query; p; p = strchr(p + 1, '&'))
+        if (strncmp(p + 1, name, length) == 0 && p[length + 1] == '=')
+            return strtoll(p + length + 2, NULL, 10);
+    return fallback;
+}
+
+static FXNStatus FXNPredictorParseTag (const char* tag, struct FXNMockModel* model) {
+    static const char prefix[] = "@mock/";
+    if (!tag || strncmp(tag, prefix, sizeof(prefix) - 1) != 0)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    const char* name = tag + sizeof(prefix) - 1;
+    const size_t length = strcspn(name, "?");
+    if (length == 4 && strncmp(name, "echo", length) == 0)
+        model->kind = FXN_MOCK_ECHO;
+    else if (length == 6 && strncmp(name, "matmul", length) == 0)
+        model->kind = FXN_MOCK_MATMUL;
+    else if (length == 5 && strncmp(name, "sleep", length) == 0)
+        model->kind = FXN_MOCK_SLEEP;
+    else if (length == 6 && strncmp(name, "tokens", length) == 0)
+        model->kind = FXN_MOCK_TOKENS;
+    else
+        return FXN_ERROR_INVALID_ARGUMENT;
+    model->size = FXNPredictorGetParameter(tag, "size", 64);
+    model->count = FXNPredictorGetParameter(tag, "count", 16);
+    model->duration = FXNPredictorGetParameter(tag, "duration", model->kind == FXN_MOCK_SLEEP ? 1000 : 0);
+    if (model->size <= 0 || model->count < 0 || model->duration < 0)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    return FXN_OK;
+}
+
+static FXNStatus FXNPredictorCreateModel (FXNConfiguration* configuration, struct FXNMockModel** model) {
+    if (!configuration)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    struct FXNMockModel* result = calloc(1, sizeof(struct FXNMockModel));
+    if (!result)
+        return FXN_ERROR_INVALID_OPERATION;
+    FXNStatus status = FXNPredictorParseTag(configuration->tag, result);
+    if (status != FXN_OK) {
+        free(result);
+        return status;
+    }
+    if (configuration->numaPolicy == FXN_NUMA_POLICY_BIND && configuration->numaNode < 0) {
+        free(result);
+        return FXN_ERROR_INVALID_ARGUMENT;
+    }
+    atomic_init(&result->references, 1);
+    result->version = atomic_fetch_add(&FXNModelVersion, 1);
+    result->numaPolicy = configuration->numaPolicy;
+    result->numaNode = configuration->numaNode;
+    // Copy resources, since the configuration can be released before they are loaded
+    if (configuration->resourceCount > 0)
+        result->resources = calloc((size_t)configuration->resourceCount, sizeof(struct FXNMockResource));
+    for (; result->resources && result->resourceCount < configuration->resourceCount; ++result->resourceCount)
+        if (FXNMockCopyResource(&configuration->resources[result->resourceCount], &result->resources[result->resourceCount]) != FXN_OK)
+            break;
+    if (result->resourceCount < configuration->resourceCount) {
+        FXNMockReleaseModel(result);
+        return FXN_ERROR_INVALID_OPERATION;
+    }
+    *model = result;
+    return FXN_OK;
+}
+
+#if defined(__linux__)
+static uint64_t FXNPredictorGetNUMANodes (void) {
+    // The list is formatted as comma-separated ranges, like `0-1`
+    FILE* file = fopen("/sys/devices/system/node/online", "r");
+    if (!file)
+        return 1;
+    uint64_t nodes = 0;
+    int first = 0;
+    while (fscanf(file, "%d", &first) == 1) {
+        int last = first;
+        int separator = fgetc(file);
+        if (separator == '-' && fscanf(file, "%d", &last) == 1)
+            separator = fgetc(file);
+        for (int node = first; node >= 0 && node <= last && node < FXN_MOCK_MAX_NUMA_NODES; ++node)
+            nodes |= 1ull << node;
+        if (separator != ',')
+            break;
+    }
+    fclose(file);
+    return nodes ? nodes : 1;
+}
+
+static float* FXNPredictorAllocateWeights (size_t size, int mode, uint64_t nodes) {
+    void* weights = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (weights == MAP_FAILED)
+        return NULL;
+    // Kernels built without NUMA support have a single node, so there is nothing to place
+    unsigned long mask = (unsigned long)nodes;
+    if (syscall(SYS_mbind, weights, size, mode, &mask, sizeof(mask) * 8 + 1, 0) != 0 && errno != ENOSYS) {
+        munmap(weights, size);
+        return NULL;
+    }
+    return weights;
+}
+#endif
+
+static void FXNPredictorFillWeights (float* weights, size_t count) {
+    for (size_t i = 0; i < count; ++i)
+        weights[i] = (float)((i * 2654435761u) % 1000) / 1000.0f - 0.5f;
+}
+
+FXNStatus FXNMockLoadModel (struct FXNMockModel* model) {
+    if (model->kind != FXN_MOCK_MATMUL)
+        return FXN_OK;
+    const size_t count = (size_t)(model->size * model->size);
+    const size_t size = sizeof(float) * count;
+    model->bytes = (int64_t)size;
+    // Weights are placed on the node of the loading thread when the first write faults them in
+    if (model->numaPolicy == FXN_NUMA_POLICY_AUTO) {
+        model->weights = malloc(size);
+        if (!model->weights)
+            return FXN_ERROR_INVALID_OPERATION;
+        FXNPredictorFillWeights(model->weights, count);
+        return FXN_OK;
+    }
+#if defined(__linux__)
+    // Validate the node before allocating, so a missing node is reported as an invalid argument
+    const uint64_t nodes = FXNPredictorGetNUMANodes();
+    if (model->numaPolicy == FXN_NUMA_POLICY_BIND && (model->numaNode >= FXN_MOCK_MAX_NUMA_NODES || !(nodes & (1ull << model->numaNode))))
+        return FXN_ERROR_INVALID_ARGUMENT;
+    switch (model->numaPolicy) {
+        case FXN_NUMA_POLICY_INTERLEAVE:
+            model->weights = FXNPredictorAllocateWeights(size, FXN_MPOL_INTERLEAVE, nodes);
+            break;
+        case FXN_NUMA_POLICY_BIND:
+            model->weights = FXNPredictorAllocateWeights(size, FXN_MPOL_BIND, 1ull << model->numaNode);
+            break;
+        case FXN_NUMA_POLICY_REPLICATE:
+            // Bind one replica to each node, with the lowest node holding the primary weights
+            model->bytes = (int64_t)size * __builtin_popcountll(nodes);
+            for (int32_t node = 0; node < FXN_MOCK_MAX_NUMA_NODES; ++node) {
+                if (!(nodes & (1ull << node)))
+                    continue;
+                model->replicas[node] = FXNPredictorAllocateWeights(size, FXN_MPOL_BIND, 1ull << node);
+                if (!model->replicas[node]) {
+                    FXNMockUnloadModel(model);
+                    return FXN_ERROR_INVALID_OPERATION;
+                }
+                FXNPredictorFillWeights(model->replicas[node], count);
+                if (!model->weights)
+                    model->weights = model->replicas[node];
+            }
+            return FXN_OK;
+        default:
+            break;
+    }
+    if (!model->weights)
+        return FXN_ERROR_INVALID_OPERATION;
+    FXNPredictorFillWeights(model->weights, count);
+    return FXN_OK;
+#else
+    return FXN_ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+void FXNMockUnloadModel (struct FXNMockModel* model) {
+    if (model->numaPolicy == FXN_NUMA_POLICY_AUTO)
+        free(model->weights);
+#if defined(__linux__)
+    else {
+        const size_t size = sizeof(float) * (size_t)(model->size * model->size);
+        if (model->numaPolicy != FXN_NUMA_POLICY_REPLICATE && model->weights)
+            munmap(model->weights, size);
+        for (int32_t node = 0; node < FXN_MOCK_MAX_NUMA_NODES; ++node)
+            if (model->replicas[node]) {
+                munmap(model->replicas[node], size);
+                model->replicas[node] = NULL;
+            }
+    }
+#endif
+    model->weights = NULL;
+}
+
+const float* FXNMockGetWeights (struct FXNMockModel* model) {
+#if defined(__linux__)
+    // Read the replica on the node of the calling thread
+    unsigned int cpu = 0, node = 0;
+    if (model->numaPolicy == FXN_NUMA_POLICY_REPLICATE && syscall(SYS_getcpu, &cpu, &node, NULL) == 0)
+        if (node < FXN_MOCK_MAX_NUMA_NODES && model->replicas[node])
+            return model->replicas[node];
+#endif
+    return model->weights;
+}
+
+static void FXNPredictorLoad (void* context, int64_t index) {
+    // Each resource loads on its own worker, alongside the model weights
+    struct FXNPredictorCreateTask* task = context;
+    struct FXNMockModel* model = task->model;
+    FXNStatus status = index < model->resourceCount ?
+        FXNMockLoadResource(&model->resources[index]) :
+        FXNMockLoadModel(model);
+    int expected = FXN_OK;
+    if (status != FXN_OK)
+        atomic_compare_exchange_strong(&task->status, &expected, status);
+}
+
+static FXNStatus FXNPredictorLoadModel (struct FXNMockModel* model) {
+    struct FXNMockExecutor* executor = NULL;
+    FXNStatus status = FXNMockGetBackgroundExecutor(&executor);
+    if (status != FXN_OK)
+        return status;
+    struct FXNPredictorCreateTask task = { .model = model };
+    atomic_init(&task.status, FXN_OK);
+    FXNMockExecute(executor, &FXNPredictorLoadSchedule, model->resourceCount + 1, FXNPredictorLoad, &task);
+    return atomic_load(&task.status);
+}
+
+static FXNStatus FXNPredictorCreateExecutor (FXNConfiguration* configuration, FXNPredictor* predictor) {
+    // The automatic policy only creates a thread pool when threading is configured
+    FXNThreadPolicy policy = configuration->threadPolicy;
+    const bool configured =
+        configuration->intraOpThreads > 0 ||
+        configuration->interOpThreads > 0 ||
+        configuration->affinityCount > 0 ||
+        configuration->numaNode >= 0;
+    if (policy == FXN_THREAD_POLICY_AUTO)
+        policy = configured ? FXN_THREAD_POLICY_DEDICATED : FXN_THREAD_POLICY_AUTO;
+    predictor->schedule.priority = configuration->priority;
+    predictor->schedule.weight = configuration->schedulingWeight;
+    predictor->schedule.concurrency = configuration->interOpThreads;
+    switch (policy) {
+        case FXN_THREAD_POLICY_DEDICATED:
+            predictor->dedicated = true;
+            return FXNMockCreateExecutor(
+                configuration->intraOpThreads,
+                configuration->affinity,
+                configuration->affinityCount,
+                configuration->numaNode,
+                &predictor->executor
+            );
+        case FXN_THREAD_POLICY_SHARED:
+            return FXNMockGetSharedExecutor(&predictor->executor);
+        default:
+            return FXN_OK;
+    }
+}
+
+static FXNStatus FXNPredictorInit (FXNConfiguration* configuration, FXNPredictor** predictor) {
+    if (!configuration || !predictor)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    FXNPredictor* result = calloc(1, sizeof(FXNPredictor));
+    if (!result)
+        return FXN_ERROR_INVALID_OPERATION;
+    FXNStatus status = FXNPredictorCreateModel(configuration, &result->model);
+    if (status != FXN_OK) {
+        free(result);
+        return status;
+    }
+    status = FXNPredictorCreateExecutor(configuration, result);
+    if (status == FXN_OK && configuration->recordingPath && *configuration->recordingPath)
+        status = FXNMockCreateRecorder(configuration->recordingPath, &result->recorder);
+    if (status != FXN_OK) {
+        if (result->dedicated)
+            FXNMockReleaseExecutor(result->executor);
+        FXNMockReleaseModel(result->model);
+        free(result);
+        return status;
+    }
+    pthread_mutex_init(&result->modelLock, NULL);
+    pthread_cond_init(&result->swapped, NULL);
+    pthread_mutex_init(&result->cacheLock, NULL);
+    result->cacheCapacity = configuration->resultCacheCapacity;
+    result->sharedMemoryOutputs = configuration->sharedMemoryOutputs;
+    *predictor = result;
+    return FXN_OK;
+}
+
+static void FXNPredictorCreateCompletion (void* context) {
+    struct FXNPredictorCreateTask* task = context;
+    FXNStatus status = atomic_load(&task->status);
+    if (status == FXN_OK)
+        FXNMockRegisterPredictor(task->predictor);
+    else {
+        FXNPredictorRelease(task->predictor);
+        task->predictor = NULL;
+    }
+    task->handler(task->context, status, task->predictor);
+    free(task);
+}
+
+static void FXNPredictorEvict (FXNPredictor* predictor, int64_t capacity);
+
+static void FXNPredictorSwapCompletion (void* context) {
+    struct FXNPredictorCreateTask* task = context;
+    FXNPredictor* predictor = task->predictor;
+    FXNStatus status = atomic_load(&task->status);
+    if (status == FXN_OK) {
+        // Switch new predictions over, then drop the predictor reference to the previous model
+        FXNMockReleaseModel(FXNMockReplaceModel(predictor, task->model));
+        // Cached results are keyed by model version, so this only reclaims memory
+        pthread_mutex_lock(&predictor->cacheLock);
+        FXNPredictorEvict(predictor, 0);
+        pthread_mutex_unlock(&predictor->cacheLock);
+    } else
+        FXNMockReleaseModel(task->model);
+    // `FXNPredictorRelease` waits for the handler to return, so the predictor remains valid
+    ++FXNPredictorSwapDepth;
+    task->handler(task->context, status, status == FXN_OK ? predictor : NULL);
+    --FXNPredictorSwapDepth;
+    free(task);
+    pthread_mutex_lock(&predictor->modelLock);
+    if (--predictor->swaps == 0)
+        pthread_cond_broadcast(&predictor->swapped);
+    pthread_mutex_unlock(&predictor->modelLock);
+}
+
+FXNStatus FXNMockBindInputs (
+    struct FXNMockModel* model,
+    FXNValueMap* inputs,
+    bool copy,
+    FXNValueMap** bound,
+    const char** error
+) {
+    *bound = NULL;
+    *error = NULL;
+    // Validate against the signature
+    FXNValue* a = NULL;
+    if (model->kind == FXN_MOCK_MATMUL) {
+        if (FXNValueMapGetValue(inputs, "a", &a) != FXN_OK) {
+            *error = "Matmul predictor requires input `a`";
+            return FXN_OK;
+        }
+        if (a->type < FXN_DTYPE_FLOAT32 || a->type > FXN_DTYPE_BOOL || a->dims != 2 || a->shape[1] != model->size) {
+            *error = "Matmul predictor requires numeric input `a` with shape (M,N) where N is the predictor size";
+            return FXN_OK;
+        }
+    }
+    // Convert
+    const bool convert = a && a->type != FXN_DTYPE_FLOAT32;
+    if (!copy && !convert)
+        return FXN_OK;
+    FXNValueMap* result = NULL;
+    FXNStatus status = FXNValueMapCreate(&result);
+    for (int32_t i = 0; status == FXN_OK && i < inputs->size; ++i) {
+        FXNValue* value = inputs->entries[i].value;
+        FXNValue* converted = NULL;
+        status = value == a ? FXNMockConvertValue(value, FXN_DTYPE_FLOAT32, &converted) : FXNMockCopyValue(value, &converted);
+        if (status == FXN_OK)
+            status = FXNValueMapSetValue(result, inputs->entries[i].key, converted);
+    }
+    if (status != FXN_OK) {
+        FXNValueMapRelease(result);
+        return status;
+    }
+    *bound = result;
+    return FXN_OK;
+}
+
+static void FXNPredictorMatmulRows (void* context, int64_t index) {
+    const struct FXNPredictorMatmulTask* task = context;
+    const int64_t n = task->model->size;
+    const float* rhs = FXNMockGetWeights(task->model);
+    const int64_t begin = index * task->rows;
+    const int64_t end = begin + task->rows < task->m ? begin + task->rows : task->m;
+    memset(task->out + begin * n, 0, sizeof(float) * (size_t)((end - begin) * n));
+    for (int64_t i = begin; i < end; ++i)
+        for (int64_t k = 0; k < n; ++k) {
+            const float x = task->lhs[i * n + k];
+            for (int64_t j = 0; j < n; ++j)
+                task->out[i * n + j] += x * rhs[k * n + j];
+        }
+}
+
+void FXNMockMatmul (
+    FXNPredictor* predictor,
+    struct FXNMockModel* model,
+    const float* lhs,
+    float* out,
+    int64_t m
+) {
+    // Split rows into a few chunks per worker, so that workers which finish early can take more
+    const int64_t chunks = 4 * (int64_t)FXNMockGetExecutorThreadCount(predictor->executor);
+    const int64_t rows = m > chunks ? (m + chunks - 1) / chunks : 1;
+    struct FXNPredictorMatmulTask task = { .model = model, .lhs = lhs, .out = out, .m = m, .rows = rows };
+    FXNMockParallelFor(predictor, (m + rows - 1) / rows, FXNPredictorMatmulRows, &task);
+}
+
+void FXNMockGenerateTokens (struct FXNMockModel* model, int32_t* tokens) {
+    for (int32_t i = 0; i < (int32_t)model->count; ++i) {
+        FXNMockSleep(model->duration);
+        tokens[i] = i;
+    }
+}
+
+static FXNStatus FXNPredictorRunMatmul (
+    FXNPredictor* predictor,
+    struct FXNMockModel* model,
+    FXNValueMap* inputs,
+    FXNValueMap* results
+) {
+    FXNValue* a = NULL;
+    FXNValueMapGetValue(inputs, "a", &a);
+    FXNValue* c = NULL;
+    FXNStatus status = FXNValueCreateArray(NULL, a->shape, 2, FXN_DTYPE_FLOAT32, FXN_VALUE_FLAG_NONE, &c);
+    if (status != FXN_OK)
+        return status;
+    FXNMockMatmul(predictor, model, a->data, c->data, a->shape[0]);
+    status = FXNValueMapSetValue(results, "c", c);
+    if (status != FXN_OK)
+        FXNValueRelease(c);
+    return status;
+}
+
+static FXNStatus FXNPredictorRunTokens (struct FXNMockModel* model, FXNValueMap* results) {
+    FXNValue* tokens = NULL;
+    const int32_t shape[] = { (int32_t)model->count };
+    FXNStatus status = FXNValueCreateArray(NULL, shape, 1, FXN_DTYPE_INT32, FXN_VALUE_FLAG_NONE, &tokens);
+    if (status != FXN_OK)
+        return status;
+    FXNMockGenerateTokens(model, tokens->data);
+    status = FXNValueMapSetValue(results, "tokens", tokens);
+    if (status != FXN_OK)
+        FXNValueRelease(tokens);
+    return status;
+}
+
+static void FXNPredictorRunKernel (void* context, int64_t index) {
+    struct FXNPredictorRunTask* task = context;
+    switch (task->model->kind) {
+        case FXN_MOCK_ECHO:     task->status = FXNMockCopyValueMap(task->inputs, task->results); break;
+        case FXN_MOCK_SLEEP:    FXNMockSleep(task->model->duration); break;
+        case FXN_MOCK_TOKENS:   task->status = FXNPredictorRunTokens(task->model, *task->results); break;
+        default:                break;
+    }
+}
+
+FXNStatus FXNMockRun (
+    FXNPredictor* predictor,
+    struct FXNMockModel* model,
+    FXNValueMap* inputs,
+    FXNValueMap** results,
+    const char** error
+) {
+    *error = NULL;
+    *results = NULL;
+    FXNStatus status = model->kind != FXN_MOCK_ECHO ? FXNValueMapCreate(results) : FXN_OK;
+    if (status != FXN_OK)
+        return status;
+    // Matmul rows run in parallel, while other kernels run as a single unit of work
+    if (model->kind == FXN_MOCK_MATMUL)
+        status = FXNPredictorRunMatmul(predictor, model, inputs, *results);
+    else {
+        struct FXNPredictorRunTask task = { .model = model, .inputs = inputs, .results = results, .status = FXN_OK };
+        FXNMockParallelFor(predictor, 1, FXNPredictorRunKernel, &task);
+        status = task.status;
+    }
+    if (status != FXN_OK && *results) {
+        FXNValueMapRelease(*results);
+        *results = NULL;
+    }
+    return status;
+}
+
+static void FXNPredictorEvict (FXNPredictor* predictor, int64_t capacity) {
+    while (predictor->cacheTail && predictor->cacheSize > capacity) {
+        struct FXNMockCacheEntry* entry = predictor->cacheTail;
+        predictor->cacheTail = entry->prev;
+        if (predictor->cacheTail)
+            predictor->cacheTail->next = NULL;
+        else
+            predictor->cacheHead = NULL;
+        struct FXNMockCacheEntry** link = &predictor->cacheBuckets[entry->hash & (uint64_t)(predictor->cacheBucketCount - 1)];
+        while (*link != entry)
+            link = &(*link)->chain;
+        *link = entry->chain;
+        --predictor->cacheCount;
+        predictor->cacheSize -= entry->size;
+        FXNValueMapRelease(entry->inputs);
+        FXNValueMapRelease(entry->results);
+        free(entry);
+    }
+}
+
+static struct FXNMockCacheEntry* FXNPredictorFind (
+    FXNPredictor* predictor,
+    uint64_t hash,
+    FXNValueMap* inputs
+) {
+    if (!predictor->cacheBuckets)
+        return NULL;
+    struct FXNMockCacheEntry* entry = predictor->cacheBuckets[hash & (uint64_t)(predictor->cacheBucketCount - 1)];
+    // Confirm that inputs match, so hash collisions never return another prediction's results
+    while (entry && (entry->hash != hash || !FXNMockCompareValueMap(entry->inputs, inputs)))
+        entry = entry->chain;
+    return entry;
+}
+
+static bool FXNPredictorGrowCache (FXNPredictor* predictor) {
+    const int32_t count = predictor->cacheBucketCount > 0 ? predictor->cacheBucketCount * 2 : 64;
+    struct FXNMockCacheEntry** buckets = calloc((size_t)count, sizeof(struct FXNMockCacheEntry*));
+    if (!buckets)
+        return false;
+    for (struct FXNMockCacheEntry* entry = predictor->cacheHead; entry; entry = entry->next) {
+        struct FXNMockCacheEntry** bucket = &buckets[entry->hash & (uint64_t)(count - 1)];
+        entry->chain = *bucket;
+        *bucket = entry;
+    }
+    free(predictor->cacheBuckets);
+    predictor->cacheBuckets = buckets;
+    predictor->cacheBucketCount = count;
+    return true;
+}
+
+static FXNValueMap* FXNPredictorLookup (FXNPredictor* predictor, uint64_t hash, FXNValueMap* inputs) {
+    FXNValueMap* results = NULL;
+    pthread_mutex_lock(&predictor->cacheLock);
+    struct FXNMockCacheEntry* entry = FXNPredictorFind(predictor, hash, inputs);
+    if (entry) {
+        // Move to front
+        if (entry != predictor->cacheHead) {
+            entry->prev->next = entry->next;
+            if (entry->next)
+                entry->next->prev = entry->prev;
+            else
+                predictor->cacheTail = entry->prev;
+            entry->prev = NULL;
+            entry->next = predictor->cacheHead;
+            predictor->cacheHead->prev = entry;
+            predictor->cacheHead = entry;
+        }
+        results = FXNMockRetainValueMap(entry->results);
+        ++predictor->cacheHits;
+    } else
+        ++predictor->cacheMisses;
+    pthread_mutex_unlock(&predictor->cacheLock);
+    return results;
+}
+
+static void FXNPredictorInsert (
+    FXNPredictor* predictor,
+    uint64_t hash,
+    FXNValueMap* inputs,
+    FXNValueMap* results
+) {
+    const int64_t size = FXNMockGetValueMapSize(inputs) + FXNMockGetValueMapSize(results);
+    if (size > predictor->cacheCapacity)
+        return;
+    struct FXNMockCacheEntry* entry = calloc(1, sizeof(struct FXNMockCacheEntry));
+    if (!entry || FXNMockCopyValueMap(inputs, &entry->inputs) != FXN_OK) {
+        free(entry);
+        return;
+    }
+    entry->hash = hash;
+    entry->size = size;
+    pthread_mutex_lock(&predictor->cacheLock);
+    // Concurrent misses on the same inputs only insert once
+    const bool valid =
+        !FXNPredictorFind(predictor, hash, inputs) &&
+        (predictor->cacheCount < predictor->cacheBucketCount || FXNPredictorGrowCache(predictor));
+    if (!valid) {
+        pthread_mutex_unlock(&predictor->cacheLock);
+        FXNValueMapRelease(entry->inputs);
+        free(entry);
+        return;
+    }
+    entry->results = FXNMockRetainValueMap(results);
+    struct FXNMockCacheEntry** bucket = &predictor->cacheBuckets[hash & (uint64_t)(predictor->cacheBucketCount - 1)];
+    entry->chain = *bucket;
+    *bucket = entry;
+    entry->next = predictor->cacheHead;
+    if (predictor->cacheHead)
+        predictor->cacheHead->prev = entry;
+    else
+        predictor->cacheTail = entry;
+    predictor->cacheHead = entry;
+    ++predictor->cacheCount;
+    predictor->cacheSize += size;
+    FXNPredictorEvict(predictor, predictor->cacheCapacity);
+    pthread_mutex_unlock(&predictor->cacheLock);
+}
+
+#pragma region --Models--
+struct FXNMockModel* FXNMockAcquireModel (FXNPredictor* predictor) {
+    pthread_mutex_lock(&predictor->modelLock);
+    struct FXNMockModel* model = predictor->model;
+    atomic_fetch_add(&model->references, 1);
+    pthread_mutex_unlock(&predictor->modelLock);
+    return model;
+}
+
+void FXNMockReleaseModel (struct FXNMockModel* model) {
+    if (atomic_fetch_sub(&model->references, 1) != 1)
+        return;
+    FXNMockUnloadModel(model);
+    for (int32_t i = 0; i < model->resourceCount; ++i)
+        FXNMockReleaseResource(&model->resources[i]);
+    free(model->resources);
+    free(model);
+}
+
+FXNStatus FXNMockPredict (
+    FXNPredictor* predictor,
+    struct FXNMockModel* model,
+    FXNValueMap* inputs,
+    FXNPrediction** prediction
+) {
+    const double start = FXNMockGetTime();
+    // Validate and convert inputs, unless they were prepared for this model
+    FXNValueMap* converted = NULL;
+    const char* error = NULL;
+    if (inputs->preparedPredictor != predictor || inputs->preparedVersion != model->version) {
+        FXNStatus status = FXNMockBindInputs(model, inputs, false, &converted, &error);
+        if (status != FXN_OK)
+            return status;
+    }
+    if (converted)
+        inputs = converted;
+    // Check cache
+    const bool cached = !error && predictor->cacheCapacity > 0;
+    const uint64_t hash = cached ? FXNMockHash(&model->version, sizeof(model->version), FXNMockHashValueMap(inputs)) : 0;
+    FXNValueMap* results = cached ? FXNPredictorLookup(predictor, hash, inputs) : NULL;
+    // Run
+    FXNStatus status = FXN_OK;
+    if (error)
+        status = FXNValueMapCreate(&results);
+    else if (!results) {
+        status = FXNMockMakeResident(predictor, model);
+        if (status == FXN_OK)
+            status = FXNMockRun(predictor, model, inputs, &results, &error);
+        // Results are moved into shared memory before they are cached, so cached results are never modified
+        if (status == FXN_OK && predictor->sharedMemoryOutputs)
+            status = FXNMockShareValueMap(results);
+        if (status == FXN_OK && cached && !error)
+            FXNPredictorInsert(predictor, hash, inputs, results);
+    }
+    if (converted)
+        FXNValueMapRelease(converted);
+    if (status != FXN_OK) {
+        if (results)
+            FXNValueMapRelease(results);
+        return status;
+    }
+    // Create prediction
+    status = FXNMockCreatePrediction(results, FXNMockGetTime() - start, prediction);
+    if (status != FXN_OK) {
+        FXNValueMapRelease(results);
+        return status;
+    }
+    (*prediction)->error = FXNMockDuplicateString(error);
+    if (error && !(*prediction)->error) {
+        FXNPredictionRelease(*prediction);
+        return FXN_ERROR_INVALID_OPERATION;
+    }
+    return FXN_OK;
+}
+#pragma endregion
+
+
+#pragma region --Lifecycle--
+FXNStatus FXNPredictorCreate (FXNConfiguration* configuration, FXNPredictor** predictor) {
+    FXNPredictor* result = NULL;
+    FXNStatus status = FXNPredictorInit(configuration, &result);
+    if (status != FXN_OK)
+        return status;
+    status = FXNPredictorLoadModel(result->model);
+    if (status != FXN_OK) {
+        FXNPredictorRelease(result);
+        return status;
+    }
+    FXNMockRegisterPredictor(result);
+    *predictor = result;
+    return FXN_OK;
+}
+
+FXNStatus FXNPredictorCreateAsync (
+    FXNConfiguration* configuration,
+    FXNPredictorCreateHandler handler,
+    void* context
+) {
+    if (!handler)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    struct FXNPredictorCreateTask* task = calloc(1, sizeof(struct FXNPredictorCreateTask));
+    if (!task)
+        return FXN_ERROR_INVALID_OPERATION;
+    struct FXNMockExecutor* executor = NULL;
+    FXNStatus status = FXNMockGetBackgroundExecutor(&executor);
+    if (status == FXN_OK)
+        status = FXNPredictorInit(configuration, &task->predictor);
+    if (status != FXN_OK) {
+        free(task);
+        return status;
+    }
+    task->model = task->predictor->model;
+    atomic_init(&task->status, FXN_OK);
+    task->handler = handler;
+    task->context = context;
+    status = FXNMockExecuteAsync(
+        executor,
+        &FXNPredictorLoadSchedule,
+        task->model->resourceCount + 1,
+        FXNPredictorLoad,
+        FXNPredictorCreateCompletion,
+        task
+    );
+    if (status != FXN_OK) {
+        FXNPredictorRelease(task->predictor);
+        free(task);
+    }
+    return status;
+}
+
+FXNStatus FXNPredictorRelease (FXNPredictor* predictor) {
+    if (!predictor)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    // Waiting from a swap handler could wait on the handler itself
+    pthread_mutex_lock(&predictor->modelLock);
+    if (FXNPredictorSwapDepth > 0 && predictor->swaps > 0) {
+        pthread_mutex_unlock(&predictor->modelLock);
+        return FXN_ERROR_INVALID_OPERATION;
+    }
+    while (predictor->swaps > 0)
+        pthread_cond_wait(&predictor->swapped, &predictor->modelLock);
+    pthread_mutex_unlock(&predictor->modelLock);
+    FXNStatus status = FXNMockUnregisterPredictor(predictor);
+    if (status != FXN_OK)
+        return status;
+    FXNMockReleaseRecorder(predictor->recorder);
+    if (predictor->dedicated)
+        FXNMockReleaseExecutor(predictor->executor);
+    FXNPredictorEvict(predictor, 0);
+    free(predictor->cacheBuckets);
+    FXNMockReleaseModel(predictor->model);
+    pthread_mutex_destroy(&predictor->cacheLock);
+    pthread_cond_destroy(&predictor->swapped);
+    pthread_mutex_destroy(&predictor->modelLock);
+    free(predictor);
+    return FXN_OK;
+}
+
+FXNStatus FXNPredictorSwapAsync (
+    FXNPredictor* predictor,
+    FXNConfiguration* configuration,
+    FXNPredictorCreateHandler handler,
+    void* context
+) {
+    if (!predictor || !configuration || !handler)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    struct FXNPredictorCreateTask* task = calloc(1, sizeof(struct FXNPredictorCreateTask));
+    if (!task)
+        return FXN_ERROR_INVALID_OPERATION;
+    struct FXNMockExecutor* executor = NULL;
+    FXNStatus status = FXNMockGetBackgroundExecutor(&executor);
+    if (status == FXN_OK)
+        status = FXNPredictorCreateModel(configuration, &task->model);
+    if (status != FXN_OK) {
+        free(task);
+        return status;
+    }
+    task->predictor = predictor;
+    atomic_init(&task->status, FXN_OK);
+    task->handler = handler;
+    task->context = context;
+    // The pending swap keeps the predictor alive until the handler returns
+    pthread_mutex_lock(&predictor->modelLock);
+    ++predictor->swaps;
+    pthread_mutex_unlock(&predictor->modelLock);
+    status = FXNMockExecuteAsync(
+        executor,
+        &FXNPredictorLoadSchedule,
+        task->model->resourceCount + 1,
+        FXNPredictorLoad,
+        FXNPredictorSwapCompletion,
+        task
+    );
+    if (status != FXN_OK) {
+        pthread_mutex_lock(&predictor->modelLock);
+        if (--predictor->swaps == 0)
+            pthread_cond_broadcast(&predictor->swapped);
+        pthread_mutex_unlock(&predictor->modelLock);
+        FXNMockReleaseModel(task->model);
+        free(task);
+    }
+    return status;
+}
+#pragma endregion
+
+
+#pragma region --Operations--
+FXNStatus FXNPredictorCreatePrediction (
+    FXNPredictor* predictor,
+    FXNValueMap* inputs,
+    FXNPrediction** prediction
+) {
+    if (!predictor || !inputs || !prediction)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    const double start = FXNMockGetTime();
+    struct FXNMockModel* model = FXNMockAcquireModel(predictor);
+    FXNStatus status = FXNMockPredict(predictor, model, inputs, prediction);
+    FXNMockReleaseModel(model);
+    if (status == FXN_OK && predictor->recorder)
+        FXNMockRecordPrediction(predictor->recorder, inputs, start, (*prediction)->latency);
+    return status;
+}
+
+FXNStatus FXNPredictorStreamPrediction (
+    FXNPredictor* predictor,
+    FXNValueMap* inputs,
+    FXNPredictionStream** stream
+) {
+    if (!predictor || !inputs || !stream)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    FXNPredictionStream* result = calloc(1, sizeof(FXNPredictionStream));
+    if (!result)
+        return FXN_ERROR_INVALID_OPERATION;
+    FXNStatus status = FXNMockCopyValueMap(inputs, &result->inputs);
+    if (status != FXN_OK) {
+        free(result);
+        return status;
+    }
+    result->predictor = predictor;
+    result->model = FXNMockAcquireModel(predictor);
+    result->count = result->model->kind == FXN_MOCK_TOKENS ? (int32_t)result->model->count : 1;
+    *stream = result;
+    return FXN_OK;
+}
+
+FXNStatus FXNPredictorCreateDuplexStream (
+    FXNPredictor* predictor,
+    FXNValueMap* inputs,
+    FXNPredictionStream** stream
+) {
+    if (!predictor || !inputs || !stream)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    FXNPredictionStream* result = calloc(1, sizeof(FXNPredictionStream));
+    if (!result)
+        return FXN_ERROR_INVALID_OPERATION;
+    result->predictor = predictor;
+    result->model = FXNMockAcquireModel(predictor);
+    result->duplex = true;
+    pthread_mutex_init(&result->lock, NULL);
+    pthread_cond_init(&result->ready, NULL);
+    FXNStatus status = inputs->size > 0 ? FXNPredictionStreamWriteInputs(result, inputs) : FXN_OK;
+    if (status != FXN_OK) {
+        FXNPredictionStreamRelease(result);
+        return status;
+    }
+    *stream = result;
+    return FXN_OK;
+}
+
+FXNStatus FXNPredictorPrepareInputs (
+    FXNPredictor* predictor,
+    FXNValueMap* inputs,
+    FXNValueMap** prepared
+) {
+    if (!predictor || !inputs || !prepared)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    struct FXNMockModel* model = FXNMockAcquireModel(predictor);
+    FXNValueMap* result = NULL;
+    const char* error = NULL;
+    FXNStatus status = FXNMockBindInputs(model, inputs, true, &result, &error);
+    if (status == FXN_OK && error)
+        status = FXN_ERROR_INVALID_ARGUMENT;
+    if (status == FXN_OK) {
+        result->preparedPredictor = predictor;
+        result->preparedVersion = model->version;
+        *prepared = result;
+    }
+    FXNMockReleaseModel(model);
+    return status;
+}
+
+FXNStatus FXNPredictorGetResultCacheStatistics (
+    FXNPredictor* predictor,
+    int64_t* hits,
+    int64_t* misses,
+    int64_t* size
+) {
+    if (!predictor)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    if (predictor->cacheCapacity <= 0)
+        return FXN_ERROR_INVALID_OPERATION;
+    pthread_mutex_lock(&predictor->cacheLock);
+    if (hits)
+        *hits = predictor->cacheHits;
+    if (misses)
+        *misses = predictor->cacheMisses;
+    if (size)
+        *size = predictor->cacheSize;
+    pthread_mutex_unlock(&predictor->cacheLock);
+    return FXN_OK;
+}
+#pragma endregion
@@ -0,0 +1,444 @@
+//
+//  FXNRecording.c
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "FXNMock.h"
+
+struct FXNRecordingBlob {
+    uint64_t hash;
+    const uint8_t* data;
+    uint64_t size;
+};
+
+struct FXNRecordingBlobTable {
+    struct FXNRecordingBlob* entries;
+    size_t count;
+    size_t capacity;
+    bool zero;
+    struct FXNRecordingBlob zeroBlob;
+};
+
+struct FXNRecordingEntry {
+    FXNValueMap* inputs;
+    double timestamp;
+    double latency;
+};
+
+struct FXNMockRecorder {
+    FILE* file;
+    pthread_mutex_t lock;
+    double origin;
+    long length;
+    bool failed;
+    struct FXNRecordingBlobTable blobs;
+};
+
+struct FXNRecording {
+    uint8_t* data;
+    struct FXNRecordingEntry* predictions;
+    int32_t count;
+};
+
+#pragma region --Blobs--
+static uint64_t FXNRecordingGetPadding (uint64_t size) {
+    return (8 - size % 8) % 8;
+}
+
+static struct FXNRecordingBlob* FXNRecordingFindBlob (struct FXNRecordingBlobTable* table, uint64_t hash) {
+    if (table->capacity == 0)
+        return NULL;
+    // Zero marks empty slots, so the zero hash is stored out of line
+    for (size_t i = hash & (table->capacity - 1); table->entries[i].hash != 0; i = (i + 1) & (table->capacity - 1))
+        if (table->entries[i].hash == hash)
+            return &table->entries[i];
+    return NULL;
+}
+
+static const struct FXNRecordingBlob* FXNRecordingGetBlob (struct FXNRecordingBlobTable* table, uint64_t hash) {
+    if (hash == 0)
+        return table->zero ? &table->zeroBlob : NULL;
+    return FXNRecordingFindBlob(table, hash);
+}
+
+static FXNStatus FXNRecordingInsertBlob (
+    struct FXNRecordingBlobTable* table,
+    uint64_t hash,
+    const uint8_t* data,
+    uint64_t size,
+    bool* inserted
+) {
+    if (inserted)
+        *inserted = false;
+    if (hash == 0) {
+        if (inserted)
+            *inserted = !table->zero;
+        table->zero = true;
+        table->zeroBlob = (struct FXNRecordingBlob){ .hash = hash, .data = data, .size = size };
+        return FXN_OK;
+    }
+    if (FXNRecordingFindBlob(table, hash))
+        return FXN_OK;
+    // Grow to keep the load factor below one half
+    if (2 * (table->count + 1) > table->capacity) {
+        struct FXNRecordingBlobTable grown = { .capacity = table->capacity > 0 ? 2 * table->capacity : 64 };
+        grown.entries = calloc(grown.capacity, sizeof(struct FXNRecordingBlob));
+        if (!grown.entries)
+            return FXN_ERROR_INVALID_OPERATION;
+        for (size_t i = 0; i < table->capacity; ++i)
+            if (table->entries[i].hash != 0)
+                FXNRecordingInsertBlob(&grown, table->entries[i].hash, table->entries[i].data, table->entries[i].size, NULL);
+        free(table->entries);
+        table->entries = grown.entries;
+        table->capacity = grown.capacity;
+    }
+    size_t i = hash & (table->capacity - 1);
+    while (table->entries[i].hash != 0)
+        i = (i + 1) & (table->capacity - 1);
+    table->entries[i].hash = hash;
+    table->entries[i].data = data;
+    table->entries[i].size = size;
+    ++table->count;
+    if (inserted)
+        *inserted = true;
+    return FXN_OK;
+}
+#pragma endregion
+
+
+#pragma region --Recorder--
+static bool FXNRecordingWrite (FILE* file, const void* data, size_t size) {
+    return size == 0 || fwrite(data, 1, size, file) == size;
+}
+
+static bool FXNRecordingWritePadding (FILE* file, uint64_t size) {
+    static const uint8_t zeros[8] = { 0 };
+    return FXNRecordingWrite(file, zeros, (size_t)FXNRecordingGetPadding(size));
+}
+
+static bool FXNRecordingWritePrediction (
+    struct FXNMockRecorder* recorder,
+    FXNValueMap* inputs,
+    double start,
+    double latency
+) {
+    FILE* file = recorder->file;
+    // Write blobs which have not been recorded yet
+    uint64_t size = sizeof(FXNRecordingPrediction);
+    for (int32_t i = 0; i < inputs->size; ++i) {
+        FXNValue* value = inputs->entries[i].value;
+        void* data = NULL;
+        FXNValueGetData(value, &data);
+        const uint64_t hash = FXNMockHash(data, data ? value->size : 0, 0);
+        size += sizeof(FXNRecordingValue) + strlen(inputs->entries[i].key) + sizeof(int32_t) * (size_t)value->dims;
+        bool inserted = false;
+        if (!data)
+            continue;
+        if (FXNRecordingInsertBlob(&recorder->blobs, hash, NULL, value->size, &inserted) != FXN_OK)
+            return false;
+        if (!inserted)
+            continue;
+        const FXNRecordingRecord record = { .type = FXN_RECORDING_RECORD_BLOB, .size = sizeof(hash) + value->size };
+        if (!FXNRecordingWrite(file, &record, sizeof(record)) ||
+            !FXNRecordingWrite(file, &hash, sizeof(hash)) ||
+            !FXNRecordingWrite(file, data, value->size) ||
+            !FXNRecordingWritePadding(file, record.size))
+            return false;
+    }
+    // Write prediction
+    const FXNRecordingRecord record = { .type = FXN_RECORDING_RECORD_PREDICTION, .size = size };
+    const FXNRecordingPrediction prediction = {
+        .timestamp = start - recorder->origin,
+        .latency = latency,
+        .valueCount = (uint32_t)inputs->size
+    };
+    if (!FXNRecordingWrite(file, &record, sizeof(record)) || !FXNRecordingWrite(file, &prediction, sizeof(prediction)))
+        return false;
+    for (int32_t i = 0; i < inputs->size; ++i) {
+        const char* key = inputs->entries[i].key;
+        FXNValue* value = inputs->entries[i].value;
+        const FXNRecordingValue entry = {
+            .type = (uint32_t)value->type,
+            .dims = (uint32_t)value->dims,
+            .keyLength = (uint32_t)strlen(key),
+            .size = value->data ? value->size : 0,
+            .checksum = FXNMockHash(value->data, value->data ? value->size : 0, 0)
+        };
+        if (!FXNRecordingWrite(file, &entry, sizeof(entry)) ||
+            !FXNRecordingWrite(file, key, entry.keyLength) ||
+            !FXNRecordingWrite(file, value->shape, sizeof(int32_t) * (size_t)value->dims))
+            return false;
+    }
+    return FXNRecordingWritePadding(file, record.size) && fflush(file) == 0;
+}
+
+FXNStatus FXNMockCreateRecorder (const char* path, struct FXNMockRecorder** recorder) {
+    if (!path || !recorder)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    FILE* file = fopen(path, "wb");
+    if (!file)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    const FXNRecordingHeader header = { .magic = FXN_RECORDING_MAGIC, .version = FXN_RECORDING_VERSION };
+    if (fwrite(&header, sizeof(header), 1, file) != 1) {
+        fclose(file);
+        return FXN_ERROR_INVALID_OPERATION;
+    }
+    struct FXNMockRecorder* result = calloc(1, sizeof(struct FXNMockRecorder));
+    if (!result) {
+        fclose(file);
+        return FXN_ERROR_INVALID_OPERATION;
+    }
+    result->file = file;
+    result->origin = -1.0;
+    result->length = (long)sizeof(header);
+    pthread_mutex_init(&result->lock, NULL);
+    *recorder = result;
+    return FXN_OK;
+}
+
+void FXNMockReleaseRecorder (struct FXNMockRecorder* recorder) {
+    if (!recorder)
+        return;
+    fclose(recorder->file);
+    pthread_mutex_destroy(&recorder->lock);
+    free(recorder->blobs.entries);
+    free(recorder);
+}
+
+void FXNMockRecordPrediction (struct FXNMockRecorder* recorder, FXNValueMap* inputs, double start, double latency) {
+    pthread_mutex_lock(&recorder->lock);
+    if (recorder->origin < 0.0)
+        recorder->origin = start;
+    // Recording stops at the first failed write, and the partial record is discarded
+    // so that the recording still holds every prediction before the failure
+    if (!recorder->failed && FXNRecordingWritePrediction(recorder, inputs, start, latency))
+        recorder->length = ftell(recorder->file);
+    else if (!recorder->failed) {
+        recorder->failed = true;
+        fflush(recorder->file);
+        // When truncation also fails, the recording ends in a partial record which readers reject
+        if (ftruncate(fileno(recorder->file), recorder->length) != 0)
+            clearerr(recorder->file);
+    }
+    pthread_mutex_unlock(&recorder->lock);
+}
+#pragma endregion
+
+
+#pragma region --Reader--
+static FXNStatus FXNRecordingCreateValue (
+    const FXNRecordingValue* entry,
+    const int32_t* shape,
+    uint8_t* data,
+    FXNValue** value
+) {
+    const bool terminated = data && entry->size > 0 && data[entry->size - 1] == '\0';
+    switch (entry->type) {
+        case FXN_DTYPE_NULL:    return FXNValueCreateNull(value);
+        case FXN_DTYPE_STRING:  return terminated ? FXNValueCreateString((const char*)data, value) : FXN_ERROR_INVALID_ARGUMENT;
+        case FXN_DTYPE_LIST:    return terminated ? FXNValueCreateList((const char*)data, value) : FXN_ERROR_INVALID_ARGUMENT;
+        case FXN_DTYPE_DICT:    return terminated ? FXNValueCreateDict((const char*)data, value) : FXN_ERROR_INVALID_ARGUMENT;
+        case FXN_DTYPE_IMAGE:
+            if (entry->dims != 3 || shape[0] < 0 || shape[1] < 0 || shape[2] < 0)
+                return FXN_ERROR_INVALID_ARGUMENT;
+            if ((uint64_t)shape[0] * (uint64_t)shape[1] * (uint64_t)shape[2] != entry->size)
+                return FXN_ERROR_INVALID_ARGUMENT;
+            return FXNValueCreateImage(data, shape[1], shape[0], shape[2], FXN_VALUE_FLAG_NONE, value);
+        case FXN_DTYPE_BINARY:
+            return FXNValueCreateBinary(data, (int32_t)entry->size, FXN_VALUE_FLAG_NONE, value);
+        default: {
+            FXNStatus status = FXNValueCreateArray(data, shape, (int32_t)entry->dims, (FXNDtype)entry->type, FXN_VALUE_FLAG_NONE, value);
+            if (status == FXN_OK && (*value)->size != entry->size) {
+                FXNValueRelease(*value);
+                return FXN_ERROR_INVALID_ARGUMENT;
+            }
+            return status;
+        }
+    }
+}
+
+static FXNStatus FXNRecordingParsePrediction (
+    FXNRecording* recording,
+    struct FXNRecordingBlobTable* blobs,
+    const uint8_t* payload,
+    uint64_t size
+) {
+    FXNRecordingPrediction header;
+    if (size < sizeof(header))
+        return FXN_ERROR_INVALID_ARGUMENT;
+    memcpy(&header, payload, sizeof(header));
+    FXNValueMap* inputs = NULL;
+    FXNStatus status = FXNValueMapCreate(&inputs);
+    if (status != FXN_OK)
+        return status;
+    uint64_t offset = sizeof(header);
+    for (uint32_t i = 0; i < header.valueCount && status == FXN_OK; ++i) {
+        FXNRecordingValue entry;
+        if (size - offset < sizeof(entry)) {
+            status = FXN_ERROR_INVALID_ARGUMENT;
+            break;
+        }
+        memcpy(&entry, payload + offset, sizeof(entry));
+        offset += sizeof(entry);
+        const uint64_t length = (uint64_t)entry.keyLength + sizeof(int32_t) * (uint64_t)entry.dims;
+        if (entry.dims > 64 || size - offset < length) {
+            status = FXN_ERROR_INVALID_ARGUMENT;
+            break;
+        }
+        char* key = malloc(entry.keyLength + 1);
+        if (!key) {
+            status = FXN_ERROR_INVALID_OPERATION;
+            break;
+        }
+        int32_t shape[64];
+        memcpy(key, payload + offset, entry.keyLength);
+        key[entry.keyLength] = '\0';
+        memcpy(shape, payload + offset + entry.keyLength, sizeof(int32_t) * entry.dims);
+        offset += length;
+        // Reference blob data in place, rejecting values which do not match the size of their blob
+        const struct FXNRecordingBlob* blob = entry.size > 0 ? FXNRecordingGetBlob(blobs, entry.checksum) : NULL;
+        uint8_t* data = blob ? (uint8_t*)blob->data : NULL;
+        FXNValue* value = NULL;
+        if (entry.size > 0 && (!blob || blob->size != entry.size))
+            status = FXN_ERROR_INVALID_ARGUMENT;
+        if (status == FXN_OK)
+            status = FXNRecordingCreateValue(&entry, shape, data, &value);
+        if (status == FXN_OK)
+            status = FXNValueMapSetValue(inputs, key, value);
+        if (status != FXN_OK && value)
+            FXNValueRelease(value);
+        free(key);
+    }
+    if (status != FXN_OK) {
+        FXNValueMapRelease(inputs);
+        return status;
+    }
+    struct FXNRecordingEntry* predictions = realloc(recording->predictions, sizeof(struct FXNRecordingEntry) * (size_t)(recording->count + 1));
+    if (!predictions) {
+        FXNValueMapRelease(inputs);
+        return FXN_ERROR_INVALID_OPERATION;
+    }
+    predictions[recording->count].inputs = inputs;
+    predictions[recording->count].timestamp = header.timestamp;
+    predictions[recording->count].latency = header.latency;
+    recording->predictions = predictions;
+    ++recording->count;
+    return FXN_OK;
+}
+
+FXNStatus FXNRecordingCreate (const char* path, FXNRecording** recording) {
+    if (!path || !recording)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    // Read
+    FILE* file = fopen(path, "rb");
+    if (!file)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    fseek(file, 0, SEEK_END);
+    const long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (length < 0) {
+        fclose(file);
+        return FXN_ERROR_INVALID_ARGUMENT;
+    }
+    FXNRecording* result = calloc(1, sizeof(FXNRecording));
+    if (result)
+        result->data = malloc(length > 0 ? (size_t)length : 1);
+    if (!result || !result->data) {
+        fclose(file);
+        free(result);
+        return FXN_ERROR_INVALID_OPERATION;
+    }
+    const size_t size = length > 0 ? fread(result->data, 1, (size_t)length, file) : 0;
+    fclose(file);
+    // Check header
+    FXNRecordingHeader header;
+    if (size < sizeof(header)) {
+        FXNRecordingRelease(result);
+        return FXN_ERROR_INVALID_ARGUMENT;
+    }
+    memcpy(&header, result->data, sizeof(header));
+    if (memcmp(header.magic, FXN_RECORDING_MAGIC, sizeof(header.magic)) != 0 || header.version != FXN_RECORDING_VERSION) {
+        FXNRecordingRelease(result);
+        return FXN_ERROR_INVALID_ARGUMENT;
+    }
+    // Parse records
+    struct FXNRecordingBlobTable blobs = { 0 };
+    FXNStatus status = FXN_OK;
+    size_t offset = sizeof(header);
+    while (status == FXN_OK && offset < size) {
+        FXNRecordingRecord record;
+        if (size - offset < sizeof(record)) {
+            status = FXN_ERROR_INVALID_ARGUMENT;
+            break;
+        }
+        memcpy(&record, result->data + offset, sizeof(record));
+        offset += sizeof(record);
+        if (size - offset < record.size) {
+            status = FXN_ERROR_INVALID_ARGUMENT;
+            break;
+        }
+        const uint8_t* payload = result->data + offset;
+        if (record.type == FXN_RECORDING_RECORD_BLOB && record.size >= sizeof(uint64_t)) {
+            uint64_t hash;
+            memcpy(&hash, payload, sizeof(hash));
+            status = FXNRecordingInsertBlob(&blobs, hash, payload + sizeof(hash), record.size - sizeof(hash), NULL);
+        } else if (record.type == FXN_RECORDING_RECORD_PREDICTION)
+            status = FXNRecordingParsePrediction(result, &blobs, payload, record.size);
+        else
+            status = FXN_ERROR_INVALID_ARGUMENT;
+        offset += record.size;
+        offset += size - offset < FXNRecordingGetPadding(record.size) ? size - offset : FXNRecordingGetPadding(record.size);
+    }
+    free(blobs.entries);
+    if (status != FXN_OK) {
+        FXNRecordingRelease(result);
+        return status;
+    }
+    *recording = result;
+    return FXN_OK;
+}
+
+FXNStatus FXNRecordingRelease (FXNRecording* recording) {
+    if (!recording)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    for (int32_t i = 0; i < recording->count; ++i)
+        FXNValueMapRelease(recording->predictions[i].inputs);
+    free(recording->predictions);
+    free(recording->data);
+    free(recording);
+    return FXN_OK;
+}
+
+FXNStatus FXNRecordingGetCount (FXNRecording* recording, int32_t* count) {
+    if (!recording || !count)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    *count = recording->count;
+    return FXN_OK;
+}
+
+FXNStatus FXNRecordingGetPrediction (
+    FXNRecording* recording,
+    int32_t index,
+    FXNValueMap** inputs,
+    double* timestamp,
+    double* latency
+) {
+    if (!recording || index < 0 || index >= recording->count)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    const struct FXNRecordingEntry* entry = &recording->predictions[index];
+    if (inputs)
+        *inputs = entry->inputs;
+    if (timestamp)
+        *timestamp = entry->timestamp;
+    if (latency)
+        *latency = entry->latency;
+    return FXN_OK;
+}
+#pragma endregion
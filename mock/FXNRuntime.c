@@ -0,0 +1,260 @@
+//
+//  FXNRuntime.c
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#include <stdlib.h>
+#include <unistd.h>
+#include "FXNMock.h"
+
+#pragma region --Executor--
+static pthread_mutex_t FXNExecutorLock = PTHREAD_MUTEX_INITIALIZER;
+static int32_t FXNExecutorThreadCount = 0;
+static struct FXNMockExecutor* FXNExecutorShared = NULL;
+static struct FXNMockExecutor* FXNExecutorBackground = NULL;
+
+FXNStatus FXNMockGetSharedExecutor (struct FXNMockExecutor** executor) {
+    // The shared executor lives until the process exits
+    FXNStatus status = FXN_OK;
+    pthread_mutex_lock(&FXNExecutorLock);
+    if (!FXNExecutorShared)
+        status = FXNMockCreateExecutor(FXNExecutorThreadCount, NULL, 0, -1, &FXNExecutorShared);
+    *executor = FXNExecutorShared;
+    pthread_mutex_unlock(&FXNExecutorLock);
+    return status;
+}
+
+FXNStatus FXNMockGetBackgroundExecutor (struct FXNMockExecutor** executor) {
+    // Loading is bound by I/O rather than compute, so it does not share workers with predictions
+    FXNStatus status = FXN_OK;
+    pthread_mutex_lock(&FXNExecutorLock);
+    if (!FXNExecutorBackground)
+        status = FXNMockCreateExecutor(0, NULL, 0, -1, &FXNExecutorBackground);
+    *executor = FXNExecutorBackground;
+    pthread_mutex_unlock(&FXNExecutorLock);
+    return status;
+}
+
+FXNStatus FXNRuntimeGetThreadCount (int32_t* threads) {
+    if (!threads)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    pthread_mutex_lock(&FXNExecutorLock);
+    *threads = FXNExecutorShared ?
+        FXNMockGetExecutorThreadCount(FXNExecutorShared) :
+        FXNExecutorThreadCount > 0 ? FXNExecutorThreadCount : (int32_t)sysconf(_SC_NPROCESSORS_ONLN);
+    pthread_mutex_unlock(&FXNExecutorLock);
+    return FXN_OK;
+}
+
+FXNStatus FXNRuntimeSetThreadCount (int32_t threads) {
+    if (threads < 0)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    FXNStatus status = FXN_OK;
+    pthread_mutex_lock(&FXNExecutorLock);
+    if (FXNExecutorShared)
+        status = FXN_ERROR_INVALID_OPERATION;
+    else
+        FXNExecutorThreadCount = threads;
+    pthread_mutex_unlock(&FXNExecutorLock);
+    return status;
+}
+#pragma endregion
+
+
+#pragma region --Memory--
+static pthread_mutex_t FXNMemoryLock = PTHREAD_MUTEX_INITIALIZER;
+static int64_t FXNMemoryBudget = 0;
+static int64_t FXNMemoryUsage = 0;
+static int64_t FXNMemoryClock = 0;
+static FXNPredictor** FXNMemoryPredictors = NULL;
+static int32_t FXNMemoryPredictorCount = 0;
+static int32_t FXNMemoryPredictorCapacity = 0;
+static FXNRuntimeResidencyHandler FXNMemoryHandler = NULL;
+static void* FXNMemoryHandlerContext = NULL;
+static pthread_cond_t FXNMemoryNotified = PTHREAD_COND_INITIALIZER;
+static _Thread_local int32_t FXNMemoryNotifyDepth = 0;
+
+struct FXNMemoryEvents {
+    FXNPredictor* reloaded;
+    FXNPredictor** evicted;
+    int32_t evictedCount;
+    FXNRuntimeResidencyHandler handler;
+    void* context;
+};
+
+static int64_t FXNMemoryGetResidentSize (struct FXNMockModel* model) {
+    return model->weights ? model->bytes : 0;
+}
+
+static void FXNMemoryEnforceBudget (FXNPredictor* exclude, struct FXNMemoryEvents* events) {
+    events->handler = FXNMemoryHandler;
+    events->context = FXNMemoryHandlerContext;
+    while (FXNMemoryBudget > 0 && FXNMemoryUsage > FXNMemoryBudget) {
+        // Find the least recently used idle predictor
+        FXNPredictor* victim = NULL;
+        for (int32_t i = 0; i < FXNMemoryPredictorCount; ++i) {
+            FXNPredictor* predictor = FXNMemoryPredictors[i];
+            struct FXNMockModel* model = predictor->model;
+            if (predictor == exclude || !model->weights || atomic_load(&model->references) > 1)
+                continue;
+            if (!victim || model->lastUsed < victim->model->lastUsed)
+                victim = predictor;
+        }
+        if (!victim)
+            break;
+        // Record the eviction, keeping the predictor alive until its handler returns
+        if (events->handler) {
+            if (!events->evicted)
+                events->evicted = malloc(sizeof(FXNPredictor*) * (size_t)FXNMemoryPredictorCount);
+            if (!events->evicted)
+                break;
+            events->evicted[events->evictedCount++] = victim;
+            ++victim->notifications;
+        }
+        // Evict
+        FXNMemoryUsage -= victim->model->bytes;
+        FXNMockUnloadModel(victim->model);
+    }
+}
+
+static void FXNMemoryCompleteNotification (FXNPredictor* predictor) {
+    pthread_mutex_lock(&FXNMemoryLock);
+    if (--predictor->notifications == 0)
+        pthread_cond_broadcast(&FXNMemoryNotified);
+    pthread_mutex_unlock(&FXNMemoryLock);
+}
+
+static void FXNMemoryNotify (struct FXNMemoryEvents* events) {
+    // Handlers run without the memory lock, while `FXNMockUnregisterPredictor` waits for them to return
+    ++FXNMemoryNotifyDepth;
+    if (events->reloaded) {
+        events->handler(events->context, events->reloaded, true);
+        FXNMemoryCompleteNotification(events->reloaded);
+    }
+    for (int32_t i = 0; i < events->evictedCount; ++i) {
+        events->handler(events->context, events->evicted[i], false);
+        FXNMemoryCompleteNotification(events->evicted[i]);
+    }
+    --FXNMemoryNotifyDepth;
+    free(events->evicted);
+}
+
+void FXNMockRegisterPredictor (FXNPredictor* predictor) {
+    struct FXNMemoryEvents events = { 0 };
+    pthread_mutex_lock(&FXNMemoryLock);
+    if (FXNMemoryPredictorCount == FXNMemoryPredictorCapacity) {
+        const int32_t capacity = FXNMemoryPredictorCapacity > 0 ? 2 * FXNMemoryPredictorCapacity : 16;
+        FXNPredictor** predictors = realloc(FXNMemoryPredictors, sizeof(FXNPredictor*) * (size_t)capacity);
+        // Predictors which cannot be registered are never evicted
+        if (!predictors) {
+            pthread_mutex_unlock(&FXNMemoryLock);
+            return;
+        }
+        FXNMemoryPredictors = predictors;
+        FXNMemoryPredictorCapacity = capacity;
+    }
+    FXNMemoryPredictors[FXNMemoryPredictorCount++] = predictor;
+    FXNMemoryUsage += FXNMemoryGetResidentSize(predictor->model);
+    predictor->model->lastUsed = ++FXNMemoryClock;
+    FXNMemoryEnforceBudget(predictor, &events);
+    pthread_mutex_unlock(&FXNMemoryLock);
+    FXNMemoryNotify(&events);
+}
+
+FXNStatus FXNMockUnregisterPredictor (FXNPredictor* predictor) {
+    pthread_mutex_lock(&FXNMemoryLock);
+    // Waiting from a residency handler could wait on the handler itself
+    if (FXNMemoryNotifyDepth > 0 && predictor->notifications > 0) {
+        pthread_mutex_unlock(&FXNMemoryLock);
+        return FXN_ERROR_INVALID_OPERATION;
+    }
+    for (int32_t i = 0; i < FXNMemoryPredictorCount; ++i)
+        if (FXNMemoryPredictors[i] == predictor) {
+            FXNMemoryPredictors[i] = FXNMemoryPredictors[--FXNMemoryPredictorCount];
+            FXNMemoryUsage -= FXNMemoryGetResidentSize(predictor->model);
+            break;
+        }
+    while (predictor->notifications > 0)
+        pthread_cond_wait(&FXNMemoryNotified, &FXNMemoryLock);
+    pthread_mutex_unlock(&FXNMemoryLock);
+    return FXN_OK;
+}
+
+struct FXNMockModel* FXNMockReplaceModel (FXNPredictor* predictor, struct FXNMockModel* model) {
+    struct FXNMemoryEvents events = { 0 };
+    pthread_mutex_lock(&FXNMemoryLock);
+    pthread_mutex_lock(&predictor->modelLock);
+    struct FXNMockModel* previous = predictor->model;
+    predictor->model = model;
+    pthread_mutex_unlock(&predictor->modelLock);
+    // The previous model is no longer accounted for, and is freed once in-flight predictions complete
+    FXNMemoryUsage += FXNMemoryGetResidentSize(model) - FXNMemoryGetResidentSize(previous);
+    model->lastUsed = ++FXNMemoryClock;
+    FXNMemoryEnforceBudget(predictor, &events);
+    pthread_mutex_unlock(&FXNMemoryLock);
+    FXNMemoryNotify(&events);
+    return previous;
+}
+
+FXNStatus FXNMockMakeResident (FXNPredictor* predictor, struct FXNMockModel* model) {
+    struct FXNMemoryEvents events = { 0 };
+    FXNStatus status = FXN_OK;
+    pthread_mutex_lock(&FXNMemoryLock);
+    if (!model->weights && model->bytes > 0) {
+        status = FXNMockLoadModel(model);
+        if (status == FXN_OK && model == predictor->model) {
+            FXNMemoryUsage += model->bytes;
+            if (FXNMemoryHandler) {
+                events.reloaded = predictor;
+                ++predictor->notifications;
+            }
+        }
+    }
+    model->lastUsed = ++FXNMemoryClock;
+    FXNMemoryEnforceBudget(predictor, &events);
+    pthread_mutex_unlock(&FXNMemoryLock);
+    FXNMemoryNotify(&events);
+    return status;
+}
+
+FXNStatus FXNRuntimeGetMemoryBudget (int64_t* bytes) {
+    if (!bytes)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    pthread_mutex_lock(&FXNMemoryLock);
+    *bytes = FXNMemoryBudget;
+    pthread_mutex_unlock(&FXNMemoryLock);
+    return FXN_OK;
+}
+
+FXNStatus FXNRuntimeSetMemoryBudget (int64_t bytes) {
+    if (bytes < 0)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    struct FXNMemoryEvents events = { 0 };
+    pthread_mutex_lock(&FXNMemoryLock);
+    FXNMemoryBudget = bytes;
+    FXNMemoryEnforceBudget(NULL, &events);
+    pthread_mutex_unlock(&FXNMemoryLock);
+    FXNMemoryNotify(&events);
+    return FXN_OK;
+}
+
+FXNStatus FXNRuntimeGetMemoryUsage (int64_t* bytes) {
+    if (!bytes)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    pthread_mutex_lock(&FXNMemoryLock);
+    *bytes = FXNMemoryUsage;
+    pthread_mutex_unlock(&FXNMemoryLock);
+    return FXN_OK;
+}
+
+FXNStatus FXNRuntimeSetResidencyHandler (FXNRuntimeResidencyHandler handler, void* context) {
+    pthread_mutex_lock(&FXNMemoryLock);
+    FXNMemoryHandler = handler;
+    FXNMemoryHandlerContext = context;
+    pthread_mutex_unlock(&FXNMemoryLock);
+    return FXN_OK;
+}
+#pragma endregion
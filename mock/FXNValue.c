@@ -0,0 +1,361 @@
+//
+//  FXNValue.c
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "FXNMock.h"
+
+static pthread_mutex_t FXNValueLock = PTHREAD_MUTEX_INITIALIZER;
+
+static size_t FXNGetElementSize (FXNDtype dtype) {
+    switch (dtype) {
+        case FXN_DTYPE_INT8:
+        case FXN_DTYPE_UINT8:
+        case FXN_DTYPE_BOOL:        return 1;
+        case FXN_DTYPE_FLOAT16:
+        case FXN_DTYPE_INT16:
+        case FXN_DTYPE_UINT16:      return 2;
+        case FXN_DTYPE_FLOAT32:
+        case FXN_DTYPE_INT32:
+        case FXN_DTYPE_UINT32:      return 4;
+        case FXN_DTYPE_FLOAT64:
+        case FXN_DTYPE_INT64:
+        case FXN_DTYPE_UINT64:      return 8;
+        default:                    return 0;
+    }
+}
+
+static FXNStatus FXNValueGetArraySize (FXNDtype dtype, const int32_t* shape, int32_t dims, size_t* size) {
+    *size = FXNGetElementSize(dtype);
+    if (*size == 0)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    for (int32_t i = 0; i < dims && shape; ++i) {
+        if (shape[i] < 0)
+            return FXN_ERROR_INVALID_ARGUMENT;
+        *size *= (size_t)shape[i];
+    }
+    return FXN_OK;
+}
+
+static FXNStatus FXNValueCreate (
+    FXNDtype type,
+    void* data,
+    size_t size,
+    const int32_t* shape,
+    int32_t dims,
+    FXNValueFlags flags,
+    FXNValue** value
+) {
+    if (!value || dims < 0 || (dims > 0 && !shape))
+        return FXN_ERROR_INVALID_ARGUMENT;
+    FXNValue* result = calloc(1, sizeof(FXNValue));
+    if (!result)
+        return FXN_ERROR_INVALID_OPERATION;
+    result->type = type;
+    result->dims = dims;
+    result->size = size;
+    if (dims > 0) {
+        result->shape = malloc(sizeof(int32_t) * (size_t)dims);
+        if (!result->shape) {
+            free(result);
+            return FXN_ERROR_INVALID_OPERATION;
+        }
+        memcpy(result->shape, shape, sizeof(int32_t) * (size_t)dims);
+    }
+    if (type == FXN_DTYPE_NULL)
+        result->data = NULL;
+    else if (flags & FXN_VALUE_FLAG_SHARED_MEMORY) {
+        result->data = FXNMockMapSharedMemory(&result->sharedMemory, size, true);
+        if (!result->data) {
+            FXNValueRelease(result);
+            return FXN_ERROR_INVALID_OPERATION;
+        }
+        if (data)
+            memcpy(result->data, data, size);
+        result->sharedMemoryOwner = true;
+    } else if (!data || (flags & FXN_VALUE_FLAG_COPY_DATA)) {
+        result->data = data ? malloc(size > 0 ? size : 1) : calloc(size > 0 ? size : 1, 1);
+        if (!result->data) {
+            FXNValueRelease(result);
+            return FXN_ERROR_INVALID_OPERATION;
+        }
+        if (data)
+            memcpy(result->data, data, size);
+        result->owner = true;
+    } else
+        result->data = data;
+    *value = result;
+    return FXN_OK;
+}
+
+#pragma region --Lifecycle--
+FXNStatus FXNValueRelease (FXNValue* value) {
+    if (!value)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    if (value->owner)
+        free(value->data);
+    if (value->sharedMemory) {
+        if (value->data)
+            munmap(value->data, value->size > 0 ? value->size : 1);
+        if (value->sharedMemoryOwner)
+            shm_unlink(value->sharedMemory);
+        free(value->sharedMemory);
+    }
+    for (int32_t i = 0; i < value->count; ++i)
+        FXNValueRelease(value->items[i]);
+    free(value->items);
+    if (value->map)
+        FXNValueMapRelease(value->map);
+    free(value->shape);
+    free(value);
+    return FXN_OK;
+}
+#pragma endregion
+
+
+#pragma region --Operations--
+void FXNMockLockValues (void) {
+    pthread_mutex_lock(&FXNValueLock);
+}
+
+void FXNMockUnlockValues (void) {
+    pthread_mutex_unlock(&FXNValueLock);
+}
+
+FXNStatus FXNValueGetData (FXNValue* value, void** data) {
+    if (!value || !data)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    if (value->type != FXN_DTYPE_LIST && value->type != FXN_DTYPE_DICT) {
+        *data = value->data;
+        return FXN_OK;
+    }
+    // Structured values are encoded to JSON when their data is requested,
+    // and the previous encoding is only replaced when the items have since been modified
+    char* json = NULL;
+    size_t size = 0;
+    FXNMockLockValues();
+    FXNStatus status = value->items || value->map ? FXNMockEncodeJSON(value, &json, &size) : FXN_OK;
+    if (json && value->data && value->size == size && memcmp(value->data, json, size) == 0)
+        free(json);
+    else if (json) {
+        if (value->owner)
+            free(value->data);
+        value->data = json;
+        value->size = size;
+        value->owner = true;
+    }
+    *data = value->data;
+    FXNMockUnlockValues();
+    return status;
+}
+
+FXNStatus FXNValueGetType (FXNValue* value, FXNDtype* type) {
+    if (!value || !type)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    *type = value->type;
+    return FXN_OK;
+}
+
+FXNStatus FXNValueGetDimensions (FXNValue* value, int32_t* dimensions) {
+    if (!value || !dimensions)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    *dimensions = value->dims;
+    return FXN_OK;
+}
+
+FXNStatus FXNValueGetShape (FXNValue* value, int32_t* shape, int32_t shapeLen) {
+    if (!value || (!shape && shapeLen > 0) || shapeLen < value->dims)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    if (value->dims > 0)
+        memcpy(shape, value->shape, sizeof(int32_t) * (size_t)value->dims);
+    return FXN_OK;
+}
+
+static FXNStatus FXNValueDecodeList (FXNValue* value) {
+    if (value->type != FXN_DTYPE_LIST)
+        return FXN_ERROR_INVALID_OPERATION;
+    FXNMockLockValues();
+    if (value->items) {
+        FXNMockUnlockValues();
+        return FXN_OK;
+    }
+    FXNValue* decoded = NULL;
+    FXNStatus status = FXNMockDecodeJSON((const char*)value->data, &decoded);
+    if (status == FXN_OK && decoded->type != FXN_DTYPE_LIST)
+        status = FXN_ERROR_INVALID_OPERATION;
+    if (status == FXN_OK) {
+        value->items = decoded->items;
+        value->count = decoded->count;
+        decoded->items = NULL;
+        decoded->count = 0;
+    }
+    if (decoded)
+        FXNValueRelease(decoded);
+    FXNMockUnlockValues();
+    return status;
+}
+
+FXNStatus FXNValueGetListLength (FXNValue* value, int32_t* length) {
+    if (!value || !length)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    FXNStatus status = FXNValueDecodeList(value);
+    if (status != FXN_OK)
+        return status;
+    *length = value->count;
+    return FXN_OK;
+}
+
+FXNStatus FXNValueGetListItem (FXNValue* value, int32_t index, FXNValue** item) {
+    if (!value || !item)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    FXNStatus status = FXNValueDecodeList(value);
+    if (status != FXN_OK)
+        return status;
+    if (index < 0 || index >= value->count)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    *item = value->items[index];
+    return FXN_OK;
+}
+
+FXNStatus FXNValueGetSharedMemoryName (FXNValue* value, char* name, int32_t size) {
+    if (!value || !name)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    if (!value->sharedMemory)
+        return FXN_ERROR_INVALID_OPERATION;
+    return FXNMockCopyString(value->sharedMemory, name, size);
+}
+#pragma endregion
+
+
+#pragma region --Constructors--
+FXNStatus FXNValueCreateArray (
+    void* data,
+    const int32_t* shape,
+    int32_t dims,
+    FXNDtype dtype,
+    FXNValueFlags flags,
+    FXNValue** value
+) {
+    size_t size = 0;
+    FXNStatus status = FXNValueGetArraySize(dtype, shape, dims, &size);
+    if (status != FXN_OK)
+        return status;
+    return FXNValueCreate(dtype, data, size, shape, dims, flags, value);
+}
+
+FXNStatus FXNValueCreateString (const char* data, FXNValue** value) {
+    if (!data)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    return FXNValueCreate(FXN_DTYPE_STRING, (void*)data, strlen(data) + 1, NULL, 0, FXN_VALUE_FLAG_COPY_DATA, value);
+}
+
+FXNStatus FXNValueCreateList (const char* data, FXNValue** value) {
+    if (!data)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    return FXNValueCreate(FXN_DTYPE_LIST, (void*)data, strlen(data) + 1, NULL, 0, FXN_VALUE_FLAG_COPY_DATA, value);
+}
+
+FXNStatus FXNValueCreateListFromValues (
+    FXNValue** items,
+    int32_t count,
+    FXNValue** value
+) {
+    if ((!items && count > 0) || count < 0)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    for (int32_t i = 0; i < count; ++i)
+        if (!items[i])
+            return FXN_ERROR_INVALID_ARGUMENT;
+    FXNStatus status = FXNValueCreate(FXN_DTYPE_LIST, NULL, 0, NULL, 0, FXN_VALUE_FLAG_NONE, value);
+    if (status != FXN_OK)
+        return status;
+    // Data is encoded lazily in `FXNValueGetData`
+    free((*value)->data);
+    (*value)->data = NULL;
+    (*value)->owner = false;
+    (*value)->items = malloc(sizeof(FXNValue*) * (size_t)(count > 0 ? count : 1));
+    if (!(*value)->items) {
+        FXNValueRelease(*value);
+        *value = NULL;
+        return FXN_ERROR_INVALID_OPERATION;
+    }
+    (*value)->count = count;
+    if (count > 0)
+        memcpy((*value)->items, items, sizeof(FXNValue*) * (size_t)count);
+    return FXN_OK;
+}
+
+FXNStatus FXNValueCreateDict (const char* data, FXNValue** value) {
+    if (!data)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    return FXNValueCreate(FXN_DTYPE_DICT, (void*)data, strlen(data) + 1, NULL, 0, FXN_VALUE_FLAG_COPY_DATA, value);
+}
+
+FXNStatus FXNValueCreateImage (
+    const uint8_t* pixelBuffer,
+    int32_t width,
+    int32_t height,
+    int32_t channels,
+    FXNValueFlags flags,
+    FXNValue** value
+) {
+    if (width <= 0 || height <= 0 || (channels != 1 && channels != 3 && channels != 4))
+        return FXN_ERROR_INVALID_ARGUMENT;
+    const int32_t shape[] = { height, width, channels };
+    const size_t size = (size_t)width * (size_t)height * (size_t)channels;
+    return FXNValueCreate(FXN_DTYPE_IMAGE, (void*)pixelBuffer, size, shape, 3, flags, value);
+}
+
+FXNStatus FXNValueCreateBinary (
+    void* buffer,
+    int32_t bufferLen,
+    FXNValueFlags flags,
+    FXNValue** value
+) {
+    if (bufferLen < 0)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    const int32_t shape[] = { bufferLen };
+    return FXNValueCreate(FXN_DTYPE_BINARY, buffer, (size_t)bufferLen, shape, 1, flags, value);
+}
+
+FXNStatus FXNValueCreateFromSharedMemory (
+    const char* name,
+    const int32_t* shape,
+    int32_t dims,
+    FXNDtype dtype,
+    FXNValue** value
+) {
+    if (!name || !value)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    size_t size = 0;
+    FXNStatus status = FXNValueGetArraySize(dtype, shape, dims, &size);
+    if (status != FXN_OK)
+        return status;
+    // Map the region first, so the value borrows it instead of allocating its own data
+    char* sharedMemory = FXNMockDuplicateString(name);
+    if (!sharedMemory)
+        return FXN_ERROR_INVALID_OPERATION;
+    void* data = FXNMockMapSharedMemory(&sharedMemory, size, false);
+    if (!data) {
+        free(sharedMemory);
+        return FXN_ERROR_INVALID_ARGUMENT;
+    }
+    status = FXNValueCreate(dtype, data, size, shape, dims, FXN_VALUE_FLAG_NONE, value);
+    if (status != FXN_OK) {
+        munmap(data, size > 0 ? size : 1);
+        free(sharedMemory);
+        return status;
+    }
+    (*value)->sharedMemory = sharedMemory;
+    return FXN_OK;
+}
+
+FXNStatus FXNValueCreateNull (FXNValue** value) {
+    return FXNValueCreate(FXN_DTYPE_NULL, NULL, 0, NULL, 0, FXN_VALUE_FLAG_NONE, value);
+}
+#pragma endregion
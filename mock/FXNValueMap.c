@@ -0,0 +1,152 @@
+//
+//  FXNValueMap.c
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include "FXNMock.h"
+
+static int32_t FXNValueMapFind (FXNValueMap* map, const char* key) {
+    for (int32_t i = 0; i < map->size; ++i)
+        if (strcmp(map->entries[i].key, key) == 0)
+            return i;
+    return -1;
+}
+
+#pragma region --Lifecycle--
+FXNStatus FXNValueMapCreate (FXNValueMap** map) {
+    if (!map)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    *map = calloc(1, sizeof(FXNValueMap));
+    if (!*map)
+        return FXN_ERROR_INVALID_OPERATION;
+    atomic_init(&(*map)->references, 1);
+    return FXN_OK;
+}
+
+FXNStatus FXNValueMapRelease (FXNValueMap* map) {
+    if (!map)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    // Cached results are shared between predictions
+    if (atomic_fetch_sub(&map->references, 1) != 1)
+        return FXN_OK;
+    for (int32_t i = 0; i < map->size; ++i) {
+        free(map->entries[i].key);
+        FXNValueRelease(map->entries[i].value);
+    }
+    free(map->entries);
+    free(map);
+    return FXN_OK;
+}
+#pragma endregion
+
+
+#pragma region --Operations--
+FXNStatus FXNValueMapGetSize (FXNValueMap* map, int32_t* size) {
+    if (!map || !size)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    *size = map->size;
+    return FXN_OK;
+}
+
+FXNStatus FXNValueMapGetKey (FXNValueMap* map, int32_t index, char* key, int32_t size) {
+    if (!map || index < 0 || index >= map->size)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    return FXNMockCopyString(map->entries[index].key, key, size);
+}
+
+FXNStatus FXNValueMapGetValue (FXNValueMap* map, const char* key, FXNValue** value) {
+    if (!map || !key || !value)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    const int32_t index = FXNValueMapFind(map, key);
+    if (index < 0)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    *value = map->entries[index].value;
+    return FXN_OK;
+}
+
+FXNStatus FXNValueMapSetValue (FXNValueMap* map, const char* key, FXNValue* value) {
+    if (!map || !key)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    // Modifying a prepared map invalidates its validation
+    map->preparedPredictor = NULL;
+    const int32_t index = FXNValueMapFind(map, key);
+    // Remove
+    if (!value) {
+        if (index < 0)
+            return FXN_OK;
+        free(map->entries[index].key);
+        FXNValueRelease(map->entries[index].value);
+        memmove(map->entries + index, map->entries + index + 1, sizeof(struct FXNValueMapEntry) * (size_t)(map->size - index - 1));
+        --map->size;
+        return FXN_OK;
+    }
+    // Replace
+    if (index >= 0) {
+        if (map->entries[index].value != value)
+            FXNValueRelease(map->entries[index].value);
+        map->entries[index].value = value;
+        return FXN_OK;
+    }
+    // Insert
+    if (map->size == map->capacity) {
+        const int32_t capacity = map->capacity > 0 ? 2 * map->capacity : 8;
+        struct FXNValueMapEntry* entries = realloc(map->entries, sizeof(struct FXNValueMapEntry) * (size_t)capacity);
+        if (!entries)
+            return FXN_ERROR_INVALID_OPERATION;
+        map->entries = entries;
+        map->capacity = capacity;
+    }
+    map->entries[map->size].key = FXNMockDuplicateString(key);
+    if (!map->entries[map->size].key)
+        return FXN_ERROR_INVALID_OPERATION;
+    map->entries[map->size].value = value;
+    ++map->size;
+    return FXN_OK;
+}
+#pragma endregion
+
+
+#pragma region --Dictionaries--
+FXNStatus FXNValueCreateDictFromValueMap (FXNValueMap* map, FXNValue** value) {
+    if (!map || !value)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    FXNValue* result = calloc(1, sizeof(FXNValue));
+    if (!result)
+        return FXN_ERROR_INVALID_OPERATION;
+    // Data is encoded lazily in `FXNValueGetData`
+    result->type = FXN_DTYPE_DICT;
+    result->map = map;
+    *value = result;
+    return FXN_OK;
+}
+
+FXNStatus FXNValueGetDictValueMap (FXNValue* value, FXNValueMap** map) {
+    if (!value || !map)
+        return FXN_ERROR_INVALID_ARGUMENT;
+    if (value->type != FXN_DTYPE_DICT)
+        return FXN_ERROR_INVALID_OPERATION;
+    FXNMockLockValues();
+    FXNStatus status = FXN_OK;
+    if (!value->map) {
+        FXNValue* decoded = NULL;
+        status = FXNMockDecodeJSON((const char*)value->data, &decoded);
+        if (status == FXN_OK && decoded->type != FXN_DTYPE_DICT)
+            status = FXN_ERROR_INVALID_OPERATION;
+        if (status == FXN_OK) {
+            value->map = decoded->map;
+            decoded->map = NULL;
+        }
+        if (decoded)
+            FXNValueRelease(decoded);
+    }
+    if (status == FXN_OK)
+        *map = value->map;
+    FXNMockUnlockValues();
+    return status;
+}
+#pragma endregion
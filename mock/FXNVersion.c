@@ -0,0 +1,16 @@
+//
+//  FXNVersion.c
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#include "FXNMock.h"
+
+#define FXN_STRINGIFY(x) #x
+#define FXN_VERSION_STRING(major, minor, patch) FXN_STRINGIFY(major) "." FXN_STRINGIFY(minor) "." FXN_STRINGIFY(patch)
+
+const char* FXNGetVersion (void) {
+    return FXN_VERSION_STRING(FXN_VERSION_MAJOR, FXN_VERSION_MINOR, FXN_VERSION_PATCH) "-mock";
+}
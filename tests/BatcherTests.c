@@ -0,0 +1,104 @@
+//
+//  BatcherTests.c
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#include <pthread.h>
+#include <string.h>
+#include <unistd.h>
+#include "Tests.h"
+
+#define FXN_TEST_SIZE 16
+#define FXN_TEST_REQUESTS 8
+
+struct FXNTestRequest {
+    FXNBatcher* batcher;
+    float value;
+    FXNStatus status;
+    float result[FXN_TEST_SIZE];
+    double latency;
+};
+
+static void* FXNTestRunRequest (void* context) {
+    struct FXNTestRequest* request = context;
+    FXNValueMap* inputs = FXNTestCreateMatmulInputs(FXN_TEST_SIZE, request->value);
+    FXNPrediction* prediction = NULL;
+    request->status = FXNBatcherCreatePrediction(request->batcher, inputs, &prediction);
+    if (request->status == FXN_OK) {
+        FXNValueMap* results = NULL;
+        FXNValue* c = NULL;
+        void* data = NULL;
+        FXN_CHECK(FXNPredictionGetResults(prediction, &results) == FXN_OK);
+        FXN_CHECK(FXNValueMapGetValue(results, "c", &c) == FXN_OK);
+        FXN_CHECK(FXNValueGetData(c, &data) == FXN_OK);
+        memcpy(request->result, data, sizeof(request->result));
+        FXN_CHECK(FXNPredictionGetLatency(prediction, &request->latency) == FXN_OK);
+        FXN_CHECK(FXNPredictionRelease(prediction) == FXN_OK);
+    }
+    FXN_CHECK(FXNValueMapRelease(inputs) == FXN_OK);
+    return NULL;
+}
+
+static void FXNTestRunRequests (FXNBatcher* batcher, struct FXNTestRequest* requests, bool release) {
+    pthread_t threads[FXN_TEST_REQUESTS];
+    for (int32_t i = 0; i < FXN_TEST_REQUESTS; ++i) {
+        requests[i] = (struct FXNTestRequest) { .batcher = batcher, .value = (float)(i + 1) };
+        FXN_CHECK(pthread_create(&threads[i], NULL, FXNTestRunRequest, &requests[i]) == 0);
+    }
+    // Release while callers are blocked waiting for their batch
+    if (release) {
+        usleep(100000);
+        FXN_CHECK(FXNBatcherRelease(batcher) == FXN_OK);
+    }
+    for (int32_t i = 0; i < FXN_TEST_REQUESTS; ++i)
+        pthread_join(threads[i], NULL);
+}
+
+static void TestBatchedResults (void) {
+    FXNPredictor* predictor = FXNTestCreatePredictor("@mock/matmul?size=16", 0, NULL);
+    FXNBatcher* batcher = NULL;
+    struct FXNTestRequest requests[FXN_TEST_REQUESTS];
+    FXN_CHECK(FXNBatcherCreate(predictor, 4, 1000, &batcher) == FXN_OK);
+    FXNTestRunRequests(batcher, requests, false);
+    FXN_CHECK(FXNBatcherRelease(batcher) == FXN_OK);
+    // Batched results must match individual predictions
+    for (int32_t i = 0; i < FXN_TEST_REQUESTS; ++i) {
+        FXNValueMap* inputs = FXNTestCreateMatmulInputs(FXN_TEST_SIZE, requests[i].value);
+        FXNValueMap* results = NULL;
+        FXNPrediction* prediction = NULL;
+        FXNValue* c = NULL;
+        void* data = NULL;
+        FXN_CHECK(requests[i].status == FXN_OK);
+        FXN_CHECK(FXNPredictorCreatePrediction(predictor, inputs, &prediction) == FXN_OK);
+        FXN_CHECK(FXNPredictionGetResults(prediction, &results) == FXN_OK);
+        FXN_CHECK(FXNValueMapGetValue(results, "c", &c) == FXN_OK);
+        FXN_CHECK(FXNValueGetData(c, &data) == FXN_OK);
+        FXN_CHECK(memcmp(data, requests[i].result, sizeof(requests[i].result)) == 0);
+        FXN_CHECK(FXNPredictionRelease(prediction) == FXN_OK);
+        FXN_CHECK(FXNValueMapRelease(inputs) == FXN_OK);
+    }
+    FXN_CHECK(FXNPredictorRelease(predictor) == FXN_OK);
+}
+
+static void TestReleaseWithBlockedCallers (void) {
+    FXNPredictor* predictor = FXNTestCreatePredictor("@mock/matmul?size=16", 0, NULL);
+    FXNBatcher* batcher = NULL;
+    struct FXNTestRequest requests[FXN_TEST_REQUESTS];
+    // The batch never fills and the delay never expires, so requests wait until release
+    FXN_CHECK(FXNBatcherCreate(predictor, 2 * FXN_TEST_REQUESTS, 60000000, &batcher) == FXN_OK);
+    FXNTestRunRequests(batcher, requests, true);
+    for (int32_t i = 0; i < FXN_TEST_REQUESTS; ++i) {
+        FXN_CHECK(requests[i].status == FXN_OK);
+        FXN_CHECK(requests[i].latency >= 50.0);
+    }
+    FXN_CHECK(FXNPredictorRelease(predictor) == FXN_OK);
+}
+
+int main (void) {
+    TestBatchedResults();
+    TestReleaseWithBlockedCallers();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,155 @@
+//
+//  BundleTests.c
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#include <string.h>
+#include <unistd.h>
+#include "FXNMock.h"
+#include "Tests.h"
+
+#define FXN_TEST_ALIGNMENT FXN_BUNDLE_MIN_ALIGNMENT
+
+static const char* FXNTestManifest = "{\"tag\":\"@mock/matmul?size=4\"}";
+
+struct FXNTestBundle {
+    FXNBundleHeader header;
+    FXNBundleSection sections[2];
+    uint8_t padding[FXN_TEST_ALIGNMENT - sizeof(FXNBundleHeader) - 2 * sizeof(FXNBundleSection)];
+    uint8_t manifest[FXN_TEST_ALIGNMENT];
+    uint8_t weights[FXN_TEST_ALIGNMENT];
+};
+
+static void FXNTestCreateBundle (struct FXNTestBundle* bundle) {
+    memset(bundle, 0, sizeof(*bundle));
+    memcpy(bundle->header.magic, FXN_BUNDLE_MAGIC, sizeof(bundle->header.magic));
+    bundle->header.version = FXN_BUNDLE_VERSION;
+    bundle->header.sectionCount = 2;
+    bundle->header.alignment = FXN_TEST_ALIGNMENT;
+    memcpy(bundle->manifest, FXNTestManifest, strlen(FXNTestManifest));
+    for (size_t i = 0; i < sizeof(bundle->weights); ++i)
+        bundle->weights[i] = (uint8_t)i;
+    bundle->sections[0] = (FXNBundleSection) {
+        .type = FXN_BUNDLE_SECTION_MANIFEST,
+        .offset = offsetof(struct FXNTestBundle, manifest),
+        .size = strlen(FXNTestManifest),
+        .name = "manifest"
+    };
+    bundle->sections[1] = (FXNBundleSection) {
+        .type = FXN_BUNDLE_SECTION_WEIGHTS,
+        .offset = offsetof(struct FXNTestBundle, weights),
+        .size = sizeof(bundle->weights),
+        .name = "bin"
+    };
+}
+
+static void FXNTestSignBundle (struct FXNTestBundle* bundle) {
+    const uint8_t* data = (const uint8_t*)bundle;
+    for (uint32_t i = 0; i < 2; ++i)
+        bundle->sections[i].checksum = FXNMockHash(data + bundle->sections[i].offset, bundle->sections[i].size, 0);
+    bundle->header.checksum = FXNMockHash(bundle->sections, sizeof(bundle->sections), 0);
+}
+
+static FXNStatus FXNTestLoadBundle (const struct FXNTestBundle* bundle, size_t size, FXNConfiguration** configuration) {
+    char path[] = "/tmp/fxn-bundle-XXXXXX";
+    const int fd = mkstemp(path);
+    FXN_CHECK(fd >= 0);
+    FXN_CHECK(write(fd, bundle, size) == (ssize_t)size);
+    close(fd);
+    *configuration = NULL;
+    FXNStatus status = FXNConfigurationCreateFromBundle(path, configuration);
+    unlink(path);
+    return status;
+}
+
+static void TestValidBundle (void) {
+    struct FXNTestBundle bundle;
+    FXNTestCreateBundle(&bundle);
+    FXNTestSignBundle(&bundle);
+    FXNConfiguration* configuration = NULL;
+    FXN_CHECK(FXNTestLoadBundle(&bundle, sizeof(bundle), &configuration) == FXN_OK);
+    char tag[64];
+    FXN_CHECK(FXNConfigurationGetTag(configuration, tag, sizeof(tag)) == FXN_OK);
+    FXN_CHECK(strcmp(tag, "@mock/matmul?size=4") == 0);
+    // Weights reference the bundle in place, which stays mapped after the file is unlinked
+    FXN_CHECK(configuration->resourceCount == 1);
+    const struct FXNMockResource* resource = &configuration->resources[0];
+    FXN_CHECK(strcmp(resource->type, "bin") == 0);
+    FXN_CHECK(resource->mapping != NULL);
+    FXN_CHECK(resource->offset == offsetof(struct FXNTestBundle, weights));
+    FXN_CHECK(resource->size == sizeof(bundle.weights));
+    FXN_CHECK(memcmp((const uint8_t*)resource->mapping->data + resource->offset, bundle.weights, resource->size) == 0);
+    FXN_CHECK(FXNConfigurationRelease(configuration) == FXN_OK);
+}
+
+static void TestInvalidBundles (void) {
+    struct FXNTestBundle bundle;
+    FXNConfiguration* configuration = NULL;
+    // Bad magic
+    FXNTestCreateBundle(&bundle);
+    bundle.header.magic[0] = 'X';
+    FXNTestSignBundle(&bundle);
+    FXN_CHECK(FXNTestLoadBundle(&bundle, sizeof(bundle), &configuration) == FXN_ERROR_INVALID_ARGUMENT);
+    // Alignment is not a power of two
+    FXNTestCreateBundle(&bundle);
+    bundle.header.alignment = 3 * FXN_TEST_ALIGNMENT;
+    FXNTestSignBundle(&bundle);
+    FXN_CHECK(FXNTestLoadBundle(&bundle, sizeof(bundle), &configuration) == FXN_ERROR_INVALID_ARGUMENT);
+    // Section table checksum mismatch
+    FXNTestCreateBundle(&bundle);
+    FXNTestSignBundle(&bundle);
+    bundle.sections[1].name[0] = 'x';
+    FXN_CHECK(FXNTestLoadBundle(&bundle, sizeof(bundle), &configuration) == FXN_ERROR_INVALID_ARGUMENT);
+    // Section data checksum mismatch
+    FXNTestCreateBundle(&bundle);
+    FXNTestSignBundle(&bundle);
+    bundle.weights[7] ^= 0xFF;
+    FXN_CHECK(FXNTestLoadBundle(&bundle, sizeof(bundle), &configuration) == FXN_ERROR_INVALID_ARGUMENT);
+    // Misaligned section
+    FXNTestCreateBundle(&bundle);
+    bundle.sections[1].offset += 16;
+    bundle.sections[1].size -= 16;
+    FXNTestSignBundle(&bundle);
+    FXN_CHECK(FXNTestLoadBundle(&bundle, sizeof(bundle), &configuration) == FXN_ERROR_INVALID_ARGUMENT);
+    // Overlapping sections
+    FXNTestCreateBundle(&bundle);
+    bundle.sections[0].size = sizeof(bundle.manifest) + 1;
+    FXNTestSignBundle(&bundle);
+    FXN_CHECK(FXNTestLoadBundle(&bundle, sizeof(bundle), &configuration) == FXN_ERROR_INVALID_ARGUMENT);
+    // Section overlapping the section table
+    FXNTestCreateBundle(&bundle);
+    bundle.sections[1].offset = 0;
+    FXNTestSignBundle(&bundle);
+    FXN_CHECK(FXNTestLoadBundle(&bundle, sizeof(bundle), &configuration) == FXN_ERROR_INVALID_ARGUMENT);
+    // Section beyond the end of the bundle
+    FXNTestCreateBundle(&bundle);
+    FXNTestSignBundle(&bundle);
+    FXN_CHECK(FXNTestLoadBundle(&bundle, sizeof(bundle) - 1, &configuration) == FXN_ERROR_INVALID_ARGUMENT);
+    // Unterminated section name
+    FXNTestCreateBundle(&bundle);
+    memset(bundle.sections[1].name, 'a', sizeof(bundle.sections[1].name));
+    FXNTestSignBundle(&bundle);
+    FXN_CHECK(FXNTestLoadBundle(&bundle, sizeof(bundle), &configuration) == FXN_ERROR_INVALID_ARGUMENT);
+    // Duplicate manifest
+    FXNTestCreateBundle(&bundle);
+    bundle.sections[1].type = FXN_BUNDLE_SECTION_MANIFEST;
+    FXNTestSignBundle(&bundle);
+    FXN_CHECK(FXNTestLoadBundle(&bundle, sizeof(bundle), &configuration) == FXN_ERROR_INVALID_ARGUMENT);
+    // Manifest is not JSON
+    FXNTestCreateBundle(&bundle);
+    memcpy(bundle.manifest, "tag=@mock/echo", 14);
+    bundle.sections[0].size = 14;
+    FXNTestSignBundle(&bundle);
+    FXN_CHECK(FXNTestLoadBundle(&bundle, sizeof(bundle), &configuration) == FXN_ERROR_INVALID_ARGUMENT);
+    // Missing file
+    FXN_CHECK(FXNConfigurationCreateFromBundle("/nonexistent/bundle.fxn", &configuration) == FXN_ERROR_INVALID_ARGUMENT);
+}
+
+int main (void) {
+    TestValidBundle();
+    TestInvalidBundles();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,95 @@
+//
+//  CacheTests.c
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#include <string.h>
+#include "Tests.h"
+
+static FXNValue* FXNTestPredict (FXNPredictor* predictor, FXNValueMap* inputs, FXNPrediction** prediction) {
+    FXNValueMap* results = NULL;
+    FXNValue* c = NULL;
+    FXN_CHECK(FXNPredictorCreatePrediction(predictor, inputs, prediction) == FXN_OK);
+    FXN_CHECK(FXNPredictionGetResults(*prediction, &results) == FXN_OK);
+    FXN_CHECK(FXNValueMapGetValue(results, "c", &c) == FXN_OK);
+    return c;
+}
+
+static void FXNTestCheckStatistics (FXNPredictor* predictor, int64_t hits, int64_t misses) {
+    int64_t cacheHits = -1, cacheMisses = -1, size = -1;
+    FXN_CHECK(FXNPredictorGetResultCacheStatistics(predictor, &cacheHits, &cacheMisses, &size) == FXN_OK);
+    FXN_CHECK(cacheHits == hits && cacheMisses == misses && size > 0);
+}
+
+static void TestCacheHits (void) {
+    FXNPredictor* predictor = FXNTestCreatePredictor("@mock/matmul?size=8", 1 << 20, NULL);
+    FXNValueMap* inputs = FXNTestCreateMatmulInputs(8, 1.0f);
+    FXNValueMap* other = FXNTestCreateMatmulInputs(8, 2.0f);
+    FXNPrediction* first = NULL;
+    FXNPrediction* second = NULL;
+    FXNPrediction* third = NULL;
+    void* x = NULL;
+    void* y = NULL;
+    FXNValue* a = FXNTestPredict(predictor, inputs, &first);
+    FXNTestCheckStatistics(predictor, 0, 1);
+    FXNValue* b = FXNTestPredict(predictor, inputs, &second);
+    FXNTestCheckStatistics(predictor, 1, 1);
+    FXN_CHECK(FXNValueGetData(a, &x) == FXN_OK && FXNValueGetData(b, &y) == FXN_OK);
+    FXN_CHECK(memcmp(x, y, 8 * sizeof(float)) == 0);
+    FXNValue* c = FXNTestPredict(predictor, other, &third);
+    FXNTestCheckStatistics(predictor, 1, 2);
+    FXN_CHECK(FXNValueGetData(c, &y) == FXN_OK && memcmp(x, y, 8 * sizeof(float)) != 0);
+    FXN_CHECK(FXNPredictionRelease(first) == FXN_OK);
+    FXN_CHECK(FXNPredictionRelease(second) == FXN_OK);
+    FXN_CHECK(FXNPredictionRelease(third) == FXN_OK);
+    FXN_CHECK(FXNValueMapRelease(inputs) == FXN_OK);
+    FXN_CHECK(FXNValueMapRelease(other) == FXN_OK);
+    FXN_CHECK(FXNPredictorRelease(predictor) == FXN_OK);
+}
+
+static void TestCacheModifiedInputs (void) {
+    // Editing a structured input in place must not hit a stale cache entry
+    FXNPredictor* predictor = FXNTestCreatePredictor("@mock/echo", 1 << 20, NULL);
+    FXNValueMap* inputs = NULL;
+    FXNValueMap* map = NULL;
+    FXNValue* dict = NULL;
+    FXNValue* item = NULL;
+    FXNPrediction* prediction = NULL;
+    FXN_CHECK(FXNValueMapCreate(&inputs) == FXN_OK);
+    FXN_CHECK(FXNValueMapCreate(&map) == FXN_OK);
+    FXN_CHECK(FXNValueCreateString("first", &item) == FXN_OK);
+    FXN_CHECK(FXNValueMapSetValue(map, "k", item) == FXN_OK);
+    FXN_CHECK(FXNValueCreateDictFromValueMap(map, &dict) == FXN_OK);
+    FXN_CHECK(FXNValueMapSetValue(inputs, "d", dict) == FXN_OK);
+    FXN_CHECK(FXNPredictorCreatePrediction(predictor, inputs, &prediction) == FXN_OK);
+    FXN_CHECK(FXNPredictionRelease(prediction) == FXN_OK);
+    FXN_CHECK(FXNValueCreateString("second", &item) == FXN_OK);
+    FXN_CHECK(FXNValueMapSetValue(map, "k", item) == FXN_OK);
+    FXN_CHECK(FXNPredictorCreatePrediction(predictor, inputs, &prediction) == FXN_OK);
+    FXNTestCheckStatistics(predictor, 0, 2);
+    FXNValueMap* results = NULL;
+    void* data = NULL;
+    FXN_CHECK(FXNPredictionGetResults(prediction, &results) == FXN_OK);
+    FXN_CHECK(FXNValueMapGetValue(results, "d", &dict) == FXN_OK);
+    FXN_CHECK(FXNValueGetData(dict, &data) == FXN_OK && strcmp(data, "{\"k\":\"second\"}") == 0);
+    FXN_CHECK(FXNPredictionRelease(prediction) == FXN_OK);
+    FXN_CHECK(FXNValueMapRelease(inputs) == FXN_OK);
+    FXN_CHECK(FXNPredictorRelease(predictor) == FXN_OK);
+}
+
+static void TestCacheDisabled (void) {
+    FXNPredictor* predictor = FXNTestCreatePredictor("@mock/echo", 0, NULL);
+    int64_t hits = 0, misses = 0, size = 0;
+    FXN_CHECK(FXNPredictorGetResultCacheStatistics(predictor, &hits, &misses, &size) == FXN_ERROR_INVALID_OPERATION);
+    FXN_CHECK(FXNPredictorRelease(predictor) == FXN_OK);
+}
+
+int main (void) {
+    TestCacheHits();
+    TestCacheModifiedInputs();
+    TestCacheDisabled();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,280 @@
+//
+//  ExecutorTests.c
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#if defined(__linux__)
+#define _GNU_SOURCE
+#include <sched.h>
+#endif
+#include <pthread.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <unistd.h>
+#include "FXNMock.h"
+#include "Tests.h"
+
+#define FXN_TEST_SIZE 32
+#define FXN_TEST_ROWS 37
+#define FXN_TEST_SLEEP 20000
+#define FXN_TEST_CALLERS 4
+#define FXN_TEST_CHUNKS 40
+
+struct FXNTestWorker {
+    pthread_t thread;
+    int32_t cores;
+    bool pinned;
+};
+
+struct FXNTestCaller {
+    FXNPredictor* predictor;
+    FXNValueMap* inputs;
+};
+
+struct FXNTestJob {
+    FXNPredictor* predictor;
+    int32_t id;
+    pthread_t thread;
+};
+
+static atomic_bool FXNTestBlocked = false;
+static atomic_int FXNTestOrderCount = 0;
+static int32_t FXNTestOrder[2 * FXN_TEST_CHUNKS];
+
+static FXNPredictor* FXNTestCreateThreadedPredictor (
+    const char* tag,
+    FXNThreadPolicy policy,
+    int32_t intraOp,
+    int32_t interOp,
+    const int32_t* cores,
+    int32_t coreCount,
+    int32_t node,
+    FXNStatus* status
+) {
+    FXNConfiguration* configuration = NULL;
+    FXNPredictor* predictor = NULL;
+    FXN_CHECK(FXNConfigurationCreate(&configuration) == FXN_OK);
+    FXN_CHECK(FXNConfigurationSetTag(configuration, tag) == FXN_OK);
+    FXN_CHECK(FXNConfigurationSetThreadPolicy(configuration, policy) == FXN_OK);
+    FXN_CHECK(FXNConfigurationSetIntraOpThreads(configuration, intraOp) == FXN_OK);
+    FXN_CHECK(FXNConfigurationSetInterOpThreads(configuration, interOp) == FXN_OK);
+    FXN_CHECK(FXNConfigurationSetCPUAffinity(configuration, cores, coreCount) == FXN_OK);
+    FXN_CHECK(FXNConfigurationSetNUMANode(configuration, node) == FXN_OK);
+    *status = FXNPredictorCreate(configuration, &predictor);
+    FXN_CHECK(FXNConfigurationRelease(configuration) == FXN_OK);
+    return predictor;
+}
+
+static void FXNTestPredictMatmul (FXNPredictor* predictor, float* result) {
+    FXNValueMap* inputs = NULL;
+    FXNValue* a = NULL;
+    const int32_t shape[] = { FXN_TEST_ROWS, FXN_TEST_SIZE };
+    FXN_CHECK(FXNValueMapCreate(&inputs) == FXN_OK);
+    FXN_CHECK(FXNValueCreateArray(NULL, shape, 2, FXN_DTYPE_FLOAT32, FXN_VALUE_FLAG_NONE, &a) == FXN_OK);
+    float* data = NULL;
+    FXN_CHECK(FXNValueGetData(a, (void**)&data) == FXN_OK);
+    for (int32_t i = 0; i < FXN_TEST_ROWS * FXN_TEST_SIZE; ++i)
+        data[i] = (float)(i % 7) - 3.0f;
+    FXN_CHECK(FXNValueMapSetValue(inputs, "a", a) == FXN_OK);
+    FXNPrediction* prediction = NULL;
+    FXNValueMap* results = NULL;
+    FXNValue* c = NULL;
+    void* output = NULL;
+    FXN_CHECK(FXNPredictorCreatePrediction(predictor, inputs, &prediction) == FXN_OK);
+    FXN_CHECK(FXNPredictionGetResults(prediction, &results) == FXN_OK);
+    FXN_CHECK(FXNValueMapGetValue(results, "c", &c) == FXN_OK);
+    FXN_CHECK(FXNValueGetData(c, &output) == FXN_OK);
+    memcpy(result, output, sizeof(float) * FXN_TEST_ROWS * FXN_TEST_SIZE);
+    FXN_CHECK(FXNPredictionRelease(prediction) == FXN_OK);
+    FXN_CHECK(FXNValueMapRelease(inputs) == FXN_OK);
+}
+
+static void FXNTestRecordWorker (void* context, int64_t index) {
+    struct FXNTestWorker* workers = context;
+    workers[index].thread = pthread_self();
+#if defined(__linux__)
+    cpu_set_t cores;
+    CPU_ZERO(&cores);
+    FXN_CHECK(pthread_getaffinity_np(pthread_self(), sizeof(cores), &cores) == 0);
+    workers[index].cores = CPU_COUNT(&cores);
+    workers[index].pinned = CPU_ISSET(0, &cores);
+#endif
+}
+
+static void* FXNTestRunCaller (void* context) {
+    struct FXNTestCaller* caller = context;
+    FXNPrediction* prediction = NULL;
+    FXN_CHECK(FXNPredictorCreatePrediction(caller->predictor, caller->inputs, &prediction) == FXN_OK);
+    FXN_CHECK(FXNPredictionRelease(prediction) == FXN_OK);
+    return NULL;
+}
+
+static void FXNTestBlock (void* context, int64_t index) {
+    while (atomic_load(&FXNTestBlocked))
+        usleep(1000);
+}
+
+static void FXNTestRecordOrder (void* context, int64_t index) {
+    const struct FXNTestJob* job = context;
+    FXNTestOrder[atomic_fetch_add(&FXNTestOrderCount, 1)] = job->id;
+}
+
+static void* FXNTestRunBlocker (void* context) {
+    FXNMockParallelFor(context, 1, FXNTestBlock, NULL);
+    return NULL;
+}
+
+static void* FXNTestRunJob (void* context) {
+    struct FXNTestJob* job = context;
+    FXNMockParallelFor(job->predictor, FXN_TEST_CHUNKS, FXNTestRecordOrder, job);
+    return NULL;
+}
+
+static FXNPredictor* FXNTestCreateScheduledPredictor (FXNPriority priority, int32_t weight) {
+    FXNConfiguration* configuration = NULL;
+    FXNPredictor* predictor = NULL;
+    FXN_CHECK(FXNConfigurationCreate(&configuration) == FXN_OK);
+    FXN_CHECK(FXNConfigurationSetTag(configuration, "@mock/echo") == FXN_OK);
+    FXN_CHECK(FXNConfigurationSetThreadPolicy(configuration, FXN_THREAD_POLICY_SHARED) == FXN_OK);
+    FXN_CHECK(FXNConfigurationSetPriority(configuration, priority) == FXN_OK);
+    FXN_CHECK(FXNConfigurationSetSchedulingWeight(configuration, weight) == FXN_OK);
+    FXN_CHECK(FXNPredictorCreate(configuration, &predictor) == FXN_OK);
+    FXN_CHECK(FXNConfigurationRelease(configuration) == FXN_OK);
+    return predictor;
+}
+
+/*!
+ @abstract Run two jobs with `FXN_TEST_CHUNKS` chunks each on the single worker of the shared executor,
+ queueing both while the worker is blocked, and record the order in which their chunks run.
+*/
+static void FXNTestRunScheduled (FXNPredictor* first, FXNPredictor* second) {
+    FXNPredictor* blocker = FXNTestCreateScheduledPredictor(FXN_PRIORITY_HIGH, 1);
+    struct FXNTestJob jobs[] = { { .predictor = first, .id = 0 }, { .predictor = second, .id = 1 } };
+    pthread_t thread;
+    atomic_store(&FXNTestBlocked, true);
+    atomic_store(&FXNTestOrderCount, 0);
+    FXN_CHECK(pthread_create(&thread, NULL, FXNTestRunBlocker, blocker) == 0);
+    usleep(50000);
+    for (int32_t i = 0; i < 2; ++i) {
+        FXN_CHECK(pthread_create(&jobs[i].thread, NULL, FXNTestRunJob, &jobs[i]) == 0);
+        usleep(50000);
+    }
+    atomic_store(&FXNTestBlocked, false);
+    pthread_join(thread, NULL);
+    for (int32_t i = 0; i < 2; ++i)
+        pthread_join(jobs[i].thread, NULL);
+    FXN_CHECK(atomic_load(&FXNTestOrderCount) == 2 * FXN_TEST_CHUNKS);
+    FXN_CHECK(FXNPredictorRelease(blocker) == FXN_OK);
+}
+
+static void TestDedicatedMatchesCallingThread (void) {
+    FXNStatus status = FXN_OK;
+    static float expected[FXN_TEST_ROWS * FXN_TEST_SIZE];
+    static float actual[FXN_TEST_ROWS * FXN_TEST_SIZE];
+    FXNPredictor* calling = FXNTestCreateThreadedPredictor("@mock/matmul?size=32", FXN_THREAD_POLICY_AUTO, 0, 0, NULL, 0, -1, &status);
+    FXN_CHECK(status == FXN_OK);
+    FXN_CHECK(!calling->executor);
+    FXNPredictor* pooled = FXNTestCreateThreadedPredictor("@mock/matmul?size=32", FXN_THREAD_POLICY_DEDICATED, 3, 0, NULL, 0, -1, &status);
+    FXN_CHECK(status == FXN_OK);
+    FXN_CHECK(FXNMockGetExecutorThreadCount(pooled->executor) == 3);
+    FXNTestPredictMatmul(calling, expected);
+    FXNTestPredictMatmul(pooled, actual);
+    FXN_CHECK(memcmp(expected, actual, sizeof(expected)) == 0);
+    FXN_CHECK(FXNPredictorRelease(pooled) == FXN_OK);
+    FXN_CHECK(FXNPredictorRelease(calling) == FXN_OK);
+}
+
+static void TestWorkersArePinned (void) {
+#if defined(__linux__)
+    FXNStatus status = FXN_OK;
+    const int32_t cores[] = { 0 };
+    FXNPredictor* predictor = FXNTestCreateThreadedPredictor("@mock/echo", FXN_THREAD_POLICY_AUTO, 2, 0, cores, 1, -1, &status);
+    FXN_CHECK(status == FXN_OK);
+    FXN_CHECK(FXNMockGetExecutorThreadCount(predictor->executor) == 2);
+    struct FXNTestWorker workers[4] = { 0 };
+    FXNMockParallelFor(predictor, 4, FXNTestRecordWorker, workers);
+    for (int32_t i = 0; i < 4; ++i) {
+        FXN_CHECK(!pthread_equal(workers[i].thread, pthread_self()));
+        FXN_CHECK(workers[i].cores == 1 && workers[i].pinned);
+    }
+    FXN_CHECK(FXNPredictorRelease(predictor) == FXN_OK);
+    // NUMA nodes which do not exist are rejected
+    FXNTestCreateThreadedPredictor("@mock/echo", FXN_THREAD_POLICY_DEDICATED, 0, 0, NULL, 0, 4096, &status);
+    FXN_CHECK(status == FXN_ERROR_INVALID_ARGUMENT);
+    // Node 0 always exists
+    predictor = FXNTestCreateThreadedPredictor("@mock/echo", FXN_THREAD_POLICY_DEDICATED, 0, 0, NULL, 0, 0, &status);
+    FXN_CHECK(status == FXN_OK);
+    FXN_CHECK(FXNPredictorRelease(predictor) == FXN_OK);
+#endif
+}
+
+static void TestInterOpThreadsBoundConcurrency (void) {
+    FXNStatus status = FXN_OK;
+    FXNPredictor* predictor = FXNTestCreateThreadedPredictor("@mock/sleep?duration=20000", FXN_THREAD_POLICY_DEDICATED, 4, 1, NULL, 0, -1, &status);
+    FXN_CHECK(status == FXN_OK);
+    FXNValueMap* inputs = NULL;
+    FXN_CHECK(FXNValueMapCreate(&inputs) == FXN_OK);
+    pthread_t threads[FXN_TEST_CALLERS];
+    struct FXNTestCaller caller = { .predictor = predictor, .inputs = inputs };
+    const double start = FXNMockGetTime();
+    for (int32_t i = 0; i < FXN_TEST_CALLERS; ++i)
+        FXN_CHECK(pthread_create(&threads[i], NULL, FXNTestRunCaller, &caller) == 0);
+    for (int32_t i = 0; i < FXN_TEST_CALLERS; ++i)
+        pthread_join(threads[i], NULL);
+    // Predictions run one at a time, even though the pool has four workers
+    FXN_CHECK(FXNMockGetTime() - start >= 0.95 * FXN_TEST_CALLERS * FXN_TEST_SLEEP / 1000.0);
+    FXN_CHECK(FXNValueMapRelease(inputs) == FXN_OK);
+    FXN_CHECK(FXNPredictorRelease(predictor) == FXN_OK);
+}
+
+static void TestSharedExecutorThreadCount (void) {
+    FXNStatus status = FXN_OK;
+    FXN_CHECK(FXNRuntimeSetThreadCount(1) == FXN_OK);
+    FXNPredictor* a = FXNTestCreateThreadedPredictor("@mock/echo", FXN_THREAD_POLICY_SHARED, 0, 0, NULL, 0, -1, &status);
+    FXN_CHECK(status == FXN_OK);
+    FXNPredictor* b = FXNTestCreateThreadedPredictor("@mock/echo", FXN_THREAD_POLICY_SHARED, 0, 0, NULL, 0, -1, &status);
+    FXN_CHECK(status == FXN_OK);
+    int32_t threads = 0;
+    FXN_CHECK(a->executor && a->executor == b->executor);
+    FXN_CHECK(FXNRuntimeGetThreadCount(&threads) == FXN_OK && threads == 1);
+    FXN_CHECK(FXNRuntimeSetThreadCount(4) == FXN_ERROR_INVALID_OPERATION);
+    FXN_CHECK(FXNPredictorRelease(a) == FXN_OK);
+    FXN_CHECK(FXNPredictorRelease(b) == FXN_OK);
+}
+
+static void TestHighPriorityRunsFirst (void) {
+    FXNPredictor* low = FXNTestCreateScheduledPredictor(FXN_PRIORITY_LOW, 1);
+    FXNPredictor* high = FXNTestCreateScheduledPredictor(FXN_PRIORITY_HIGH, 1);
+    FXNTestRunScheduled(low, high);
+    // The low priority job was queued first, but only runs once the high priority job has no chunks left
+    for (int32_t i = 0; i < FXN_TEST_CHUNKS; ++i)
+        FXN_CHECK(FXNTestOrder[i] == 1);
+    FXN_CHECK(FXNPredictorRelease(high) == FXN_OK);
+    FXN_CHECK(FXNPredictorRelease(low) == FXN_OK);
+}
+
+static void TestWeightsShareWorkers (void) {
+    FXNPredictor* heavy = FXNTestCreateScheduledPredictor(FXN_PRIORITY_NORMAL, 3);
+    FXNPredictor* light = FXNTestCreateScheduledPredictor(FXN_PRIORITY_NORMAL, 1);
+    FXNTestRunScheduled(heavy, light);
+    // While both jobs have chunks left, the heavy predictor runs three chunks for each light chunk
+    int32_t count = 0;
+    for (int32_t i = 0; i < FXN_TEST_CHUNKS; ++i)
+        count += FXNTestOrder[i] == 0;
+    FXN_CHECK(count >= 29 && count <= 31);
+    FXN_CHECK(FXNPredictorRelease(light) == FXN_OK);
+    FXN_CHECK(FXNPredictorRelease(heavy) == FXN_OK);
+}
+
+int main (void) {
+    TestDedicatedMatchesCallingThread();
+    TestWorkersArePinned();
+    TestInterOpThreadsBoundConcurrency();
+    TestSharedExecutorThreadCount();
+    TestHighPriorityRunsFirst();
+    TestWeightsShareWorkers();
+    return EXIT_SUCCESS;
+}
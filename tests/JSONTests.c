@@ -0,0 +1,105 @@
+//
+//  JSONTests.c
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#include <math.h>
+#include <string.h>
+#include "Tests.h"
+
+static FXNDtype FXNTestGetType (FXNValue* value) {
+    FXNDtype type = FXN_DTYPE_NULL;
+    FXN_CHECK(FXNValueGetType(value, &type) == FXN_OK);
+    return type;
+}
+
+static void TestDecodeList (void) {
+    FXNValue* list = NULL;
+    FXNValue* item = NULL;
+    int32_t length = 0;
+    void* data = NULL;
+    FXN_CHECK(FXNValueCreateList("[1, -2.5e1, \"a\\u00e9\\ud83d\\ude00\", [true, null], {\"k\": [3]}]", &list) == FXN_OK);
+    FXN_CHECK(FXNValueGetListLength(list, &length) == FXN_OK && length == 5);
+    FXN_CHECK(FXNValueGetListItem(list, 0, &item) == FXN_OK && FXNTestGetType(item) == FXN_DTYPE_INT64);
+    FXN_CHECK(FXNValueGetData(item, &data) == FXN_OK && *(int64_t*)data == 1);
+    FXN_CHECK(FXNValueGetListItem(list, 1, &item) == FXN_OK && FXNTestGetType(item) == FXN_DTYPE_FLOAT64);
+    FXN_CHECK(FXNValueGetData(item, &data) == FXN_OK && *(double*)data == -25.0);
+    FXN_CHECK(FXNValueGetListItem(list, 2, &item) == FXN_OK && FXNTestGetType(item) == FXN_DTYPE_STRING);
+    FXN_CHECK(FXNValueGetData(item, &data) == FXN_OK && strcmp(data, "a\xc3\xa9\xf0\x9f\x98\x80") == 0);
+    FXN_CHECK(FXNValueGetListItem(list, 3, &item) == FXN_OK && FXNValueGetListLength(item, &length) == FXN_OK && length == 2);
+    FXN_CHECK(FXNValueGetListItem(list, 4, &item) == FXN_OK && FXNTestGetType(item) == FXN_DTYPE_DICT);
+    FXNValueMap* map = NULL;
+    FXN_CHECK(FXNValueGetDictValueMap(item, &map) == FXN_OK);
+    FXN_CHECK(FXNValueMapGetValue(map, "k", &item) == FXN_OK && FXNValueGetListLength(item, &length) == FXN_OK && length == 1);
+    FXN_CHECK(FXNValueGetListItem(list, 5, &item) == FXN_ERROR_INVALID_ARGUMENT);
+    FXN_CHECK(FXNValueRelease(list) == FXN_OK);
+}
+
+static void TestRejectInvalidJSON (void) {
+    const char* invalid[] = {
+        "[1}",
+        "[[1}]",
+        "[{\"a\":[1}}]",
+        "[01]",
+        "[1.]",
+        "[1,]",
+        "[\"\\udc00\"]",
+        "[\"\\ud800\"]",
+        "[\"\\ud800\\u0041\"]",
+        "[tru]",
+        "[1] 2",
+    };
+    for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i) {
+        FXNValue* list = NULL;
+        FXNValue* item = NULL;
+        int32_t length = 0;
+        FXN_CHECK(FXNValueCreateList(invalid[i], &list) == FXN_OK);
+        // Nested containers are decoded when accessed
+        FXNStatus status = FXNValueGetListLength(list, &length);
+        if (status == FXN_OK && FXNValueGetListItem(list, 0, &item) == FXN_OK && FXNTestGetType(item) == FXN_DTYPE_LIST)
+            status = FXNValueGetListLength(item, &length);
+        if (status == FXN_OK && FXNValueGetListItem(list, 0, &item) == FXN_OK && FXNTestGetType(item) == FXN_DTYPE_DICT) {
+            FXNValueMap* map = NULL;
+            FXN_CHECK(FXNValueGetDictValueMap(item, &map) == FXN_OK);
+            status = FXNValueMapGetValue(map, "a", &item);
+            if (status == FXN_OK)
+                status = FXNValueGetListLength(item, &length);
+        }
+        if (status == FXN_OK) {
+            fprintf(stderr, "Accepted invalid JSON: %s\n", invalid[i]);
+            exit(EXIT_FAILURE);
+        }
+        FXN_CHECK(FXNValueRelease(list) == FXN_OK);
+    }
+}
+
+static void TestEncodeStructuredValues (void) {
+    FXNValue* items[3] = { NULL };
+    const float numbers[] = { 1.5f, NAN };
+    const int32_t shape[] = { 2 };
+    FXN_CHECK(FXNValueCreateArray((void*)numbers, shape, 1, FXN_DTYPE_FLOAT32, FXN_VALUE_FLAG_COPY_DATA, &items[0]) == FXN_OK);
+    FXN_CHECK(FXNValueCreateString("a\"b\n", &items[1]) == FXN_OK);
+    FXNValueMap* map = NULL;
+    FXNValue* flag = NULL;
+    const bool truth = true;
+    FXN_CHECK(FXNValueMapCreate(&map) == FXN_OK);
+    FXN_CHECK(FXNValueCreateArray((void*)&truth, NULL, 0, FXN_DTYPE_BOOL, FXN_VALUE_FLAG_COPY_DATA, &flag) == FXN_OK);
+    FXN_CHECK(FXNValueMapSetValue(map, "flag", flag) == FXN_OK);
+    FXN_CHECK(FXNValueCreateDictFromValueMap(map, &items[2]) == FXN_OK);
+    FXNValue* list = NULL;
+    void* data = NULL;
+    FXN_CHECK(FXNValueCreateListFromValues(items, 3, &list) == FXN_OK);
+    FXN_CHECK(FXNValueGetData(list, &data) == FXN_OK);
+    FXN_CHECK(strcmp(data, "[[1.5,null],\"a\\\"b\\n\",{\"flag\":true}]") == 0);
+    FXN_CHECK(FXNValueRelease(list) == FXN_OK);
+}
+
+int main (void) {
+    TestDecodeList();
+    TestRejectInvalidJSON();
+    TestEncodeStructuredValues();
+    return EXIT_SUCCESS;
+}
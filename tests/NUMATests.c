@@ -0,0 +1,103 @@
+//
+//  NUMATests.c
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#include <string.h>
+#include "FXNMock.h"
+#include "Tests.h"
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#define FXN_TEST_SIZE 16
+#define FXN_TEST_MPOL_F_ADDR 2
+
+static FXNStatus FXNTestCreatePlacedPredictor (FXNNUMAPolicy policy, int32_t node, FXNPredictor** predictor) {
+    FXNConfiguration* configuration = NULL;
+    FXN_CHECK(FXNConfigurationCreate(&configuration) == FXN_OK);
+    FXN_CHECK(FXNConfigurationSetTag(configuration, "@mock/matmul?size=16") == FXN_OK);
+    FXN_CHECK(FXNConfigurationSetNUMAPolicy(configuration, policy) == FXN_OK);
+    FXN_CHECK(FXNConfigurationSetNUMANode(configuration, node) == FXN_OK);
+    FXNStatus status = FXNPredictorCreate(configuration, predictor);
+    FXN_CHECK(FXNConfigurationRelease(configuration) == FXN_OK);
+    return status;
+}
+
+static void FXNTestPredict (FXNPredictor* predictor, float* result) {
+    FXNValueMap* inputs = FXNTestCreateMatmulInputs(FXN_TEST_SIZE, 0.25f);
+    FXNPrediction* prediction = NULL;
+    FXNValueMap* results = NULL;
+    FXNValue* c = NULL;
+    void* data = NULL;
+    FXN_CHECK(FXNPredictorCreatePrediction(predictor, inputs, &prediction) == FXN_OK);
+    FXN_CHECK(FXNPredictionGetResults(prediction, &results) == FXN_OK);
+    FXN_CHECK(FXNValueMapGetValue(results, "c", &c) == FXN_OK);
+    FXN_CHECK(FXNValueGetData(c, &data) == FXN_OK);
+    memcpy(result, data, sizeof(float) * FXN_TEST_SIZE);
+    FXN_CHECK(FXNPredictionRelease(prediction) == FXN_OK);
+    FXN_CHECK(FXNValueMapRelease(inputs) == FXN_OK);
+}
+
+static int FXNTestGetPolicy (const void* address) {
+    int mode = -1;
+#if defined(__linux__)
+    unsigned long mask = 0;
+    if (syscall(SYS_get_mempolicy, &mode, &mask, sizeof(mask) * 8 + 1, address, FXN_TEST_MPOL_F_ADDR) != 0)
+        return -1;
+#endif
+    return mode;
+}
+
+static void TestPoliciesPreserveResults (void) {
+    float expected[FXN_TEST_SIZE];
+    float actual[FXN_TEST_SIZE];
+    FXNPredictor* predictor = NULL;
+    FXN_CHECK(FXNTestCreatePlacedPredictor(FXN_NUMA_POLICY_AUTO, -1, &predictor) == FXN_OK);
+    FXNTestPredict(predictor, expected);
+    FXN_CHECK(FXNPredictorRelease(predictor) == FXN_OK);
+    const FXNNUMAPolicy policies[] = { FXN_NUMA_POLICY_INTERLEAVE, FXN_NUMA_POLICY_BIND, FXN_NUMA_POLICY_REPLICATE };
+    for (size_t i = 0; i < sizeof(policies) / sizeof(policies[0]); ++i) {
+        FXN_CHECK(FXNTestCreatePlacedPredictor(policies[i], 0, &predictor) == FXN_OK);
+        FXNTestPredict(predictor, actual);
+        FXN_CHECK(memcmp(expected, actual, sizeof(expected)) == 0);
+        FXN_CHECK(FXNPredictorRelease(predictor) == FXN_OK);
+    }
+}
+
+static void TestWeightsArePlaced (void) {
+#if defined(__linux__)
+    FXNPredictor* predictor = NULL;
+    FXN_CHECK(FXNTestCreatePlacedPredictor(FXN_NUMA_POLICY_INTERLEAVE, -1, &predictor) == FXN_OK);
+    FXN_CHECK(FXNTestGetPolicy(predictor->model->weights) == 3);
+    FXN_CHECK(FXNPredictorRelease(predictor) == FXN_OK);
+    FXN_CHECK(FXNTestCreatePlacedPredictor(FXN_NUMA_POLICY_BIND, 0, &predictor) == FXN_OK);
+    FXN_CHECK(FXNTestGetPolicy(predictor->model->weights) == 2);
+    FXN_CHECK(FXNPredictorRelease(predictor) == FXN_OK);
+    // Node 0 always exists, so it holds the primary replica
+    FXN_CHECK(FXNTestCreatePlacedPredictor(FXN_NUMA_POLICY_REPLICATE, -1, &predictor) == FXN_OK);
+    FXN_CHECK(predictor->model->replicas[0] == predictor->model->weights);
+    FXN_CHECK(FXNMockGetWeights(predictor->model) != NULL);
+    FXN_CHECK(FXNTestGetPolicy(predictor->model->weights) == 2);
+    FXN_CHECK(FXNPredictorRelease(predictor) == FXN_OK);
+#endif
+}
+
+static void TestBindRequiresNode (void) {
+    FXNPredictor* predictor = NULL;
+    FXN_CHECK(FXNTestCreatePlacedPredictor(FXN_NUMA_POLICY_BIND, -1, &predictor) == FXN_ERROR_INVALID_ARGUMENT);
+#if defined(__linux__)
+    FXN_CHECK(FXNTestCreatePlacedPredictor(FXN_NUMA_POLICY_BIND, 63, &predictor) == FXN_ERROR_INVALID_ARGUMENT);
+#endif
+}
+
+int main (void) {
+    TestPoliciesPreserveResults();
+    TestWeightsArePlaced();
+    TestBindRequiresNode();
+    return EXIT_SUCCESS;
+}
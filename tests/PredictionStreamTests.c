@@ -0,0 +1,117 @@
+//
+//  PredictionStreamTests.c
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#include <pthread.h>
+#include <string.h>
+#include <unistd.h>
+#include "Tests.h"
+
+static FXNValueMap* FXNTestCreateChunk (int32_t index) {
+    FXNValueMap* inputs = NULL;
+    FXNValue* value = NULL;
+    FXN_CHECK(FXNValueMapCreate(&inputs) == FXN_OK);
+    FXN_CHECK(FXNValueCreateArray((void*)&index, NULL, 0, FXN_DTYPE_INT32, FXN_VALUE_FLAG_COPY_DATA, &value) == FXN_OK);
+    FXN_CHECK(FXNValueMapSetValue(inputs, "index", value) == FXN_OK);
+    return inputs;
+}
+
+static void TestDuplexStream (void) {
+    FXNPredictor* predictor = FXNTestCreatePredictor("@mock/echo", 0, NULL);
+    FXNValueMap* inputs = FXNTestCreateChunk(0);
+    FXNPredictionStream* stream = NULL;
+    FXN_CHECK(FXNPredictorCreateDuplexStream(predictor, inputs, &stream) == FXN_OK);
+    FXN_CHECK(FXNValueMapRelease(inputs) == FXN_OK);
+    for (int32_t i = 1; i <= 3; ++i) {
+        FXNValueMap* chunk = FXNTestCreateChunk(i);
+        FXN_CHECK(FXNPredictionStreamWriteInputs(stream, chunk) == FXN_OK);
+        FXN_CHECK(FXNValueMapRelease(chunk) == FXN_OK);
+    }
+    FXN_CHECK(FXNPredictionStreamCloseInputs(stream) == FXN_OK);
+    FXNValueMap* chunk = FXNTestCreateChunk(4);
+    FXN_CHECK(FXNPredictionStreamWriteInputs(stream, chunk) == FXN_ERROR_INVALID_OPERATION);
+    FXN_CHECK(FXNValueMapRelease(chunk) == FXN_OK);
+    // Predictions are made for each chunk in order
+    int32_t expected = 0;
+    FXNPrediction* prediction = NULL;
+    while (FXNPredictionStreamReadNext(stream, &prediction) == FXN_OK) {
+        FXNValueMap* results = NULL;
+        FXNValue* value = NULL;
+        void* data = NULL;
+        FXN_CHECK(FXNPredictionGetResults(prediction, &results) == FXN_OK);
+        FXN_CHECK(FXNValueMapGetValue(results, "index", &value) == FXN_OK);
+        FXN_CHECK(FXNValueGetData(value, &data) == FXN_OK && *(int32_t*)data == expected++);
+        FXN_CHECK(FXNPredictionRelease(prediction) == FXN_OK);
+    }
+    FXN_CHECK(expected == 4);
+    FXN_CHECK(FXNPredictionStreamRelease(stream) == FXN_OK);
+    FXN_CHECK(FXNPredictorRelease(predictor) == FXN_OK);
+}
+
+struct FXNTestReader {
+    FXNPredictionStream* stream;
+    FXNStatus status;
+};
+
+static void* FXNTestReadStream (void* context) {
+    struct FXNTestReader* reader = context;
+    FXNPrediction* prediction = NULL;
+    reader->status = FXNPredictionStreamReadNext(reader->stream, &prediction);
+    if (reader->status == FXN_OK)
+        FXNPredictionRelease(prediction);
+    return NULL;
+}
+
+static void TestReleaseWithBlockedReader (void) {
+    FXNPredictor* predictor = FXNTestCreatePredictor("@mock/echo", 0, NULL);
+    FXNValueMap* inputs = FXNTestCreateChunk(0);
+    FXNPredictionStream* stream = NULL;
+    FXNPrediction* prediction = NULL;
+    FXN_CHECK(FXNPredictorCreateDuplexStream(predictor, inputs, &stream) == FXN_OK);
+    FXN_CHECK(FXNValueMapRelease(inputs) == FXN_OK);
+    FXN_CHECK(FXNPredictionStreamReadNext(stream, &prediction) == FXN_OK);
+    FXN_CHECK(FXNPredictionRelease(prediction) == FXN_OK);
+    // The reader blocks because the inputs are still open
+    struct FXNTestReader reader = { .stream = stream, .status = FXN_OK };
+    pthread_t thread;
+    FXN_CHECK(pthread_create(&thread, NULL, FXNTestReadStream, &reader) == 0);
+    usleep(50000);
+    FXN_CHECK(FXNPredictionStreamRelease(stream) == FXN_OK);
+    pthread_join(thread, NULL);
+    FXN_CHECK(reader.status == FXN_ERROR_INVALID_OPERATION);
+    FXN_CHECK(FXNPredictorRelease(predictor) == FXN_OK);
+}
+
+static void TestTokenStream (void) {
+    FXNPredictor* predictor = FXNTestCreatePredictor("@mock/tokens?count=5&duration=0", 0, NULL);
+    FXNValueMap* inputs = NULL;
+    FXNPredictionStream* stream = NULL;
+    FXNPrediction* prediction = NULL;
+    int32_t count = 0;
+    FXN_CHECK(FXNValueMapCreate(&inputs) == FXN_OK);
+    FXN_CHECK(FXNPredictorStreamPrediction(predictor, inputs, &stream) == FXN_OK);
+    while (FXNPredictionStreamReadNext(stream, &prediction) == FXN_OK) {
+        FXNValueMap* results = NULL;
+        FXNValue* token = NULL;
+        void* data = NULL;
+        FXN_CHECK(FXNPredictionGetResults(prediction, &results) == FXN_OK);
+        FXN_CHECK(FXNValueMapGetValue(results, "token", &token) == FXN_OK);
+        FXN_CHECK(FXNValueGetData(token, &data) == FXN_OK && *(int32_t*)data == count++);
+        FXN_CHECK(FXNPredictionRelease(prediction) == FXN_OK);
+    }
+    FXN_CHECK(count == 5);
+    FXN_CHECK(FXNPredictionStreamRelease(stream) == FXN_OK);
+    FXN_CHECK(FXNValueMapRelease(inputs) == FXN_OK);
+    FXN_CHECK(FXNPredictorRelease(predictor) == FXN_OK);
+}
+
+int main (void) {
+    TestDuplexStream();
+    TestReleaseWithBlockedReader();
+    TestTokenStream();
+    return EXIT_SUCCESS;
+}
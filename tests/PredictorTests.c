@@ -0,0 +1,151 @@
+//
+//  PredictorTests.c
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#include <string.h>
+#include <unistd.h>
+#include "FXNMock.h"
+#include "Tests.h"
+
+struct FXNTestHandler {
+    pthread_mutex_t lock;
+    pthread_cond_t invoked;
+    bool done;
+    FXNStatus status;
+    FXNPredictor* predictor;
+};
+
+static void FXNTestHandlerInvoke (void* context, FXNStatus status, FXNPredictor* predictor) {
+    struct FXNTestHandler* handler = context;
+    pthread_mutex_lock(&handler->lock);
+    handler->done = true;
+    handler->status = status;
+    handler->predictor = predictor;
+    pthread_cond_signal(&handler->invoked);
+    pthread_mutex_unlock(&handler->lock);
+}
+
+static void FXNTestHandlerWait (struct FXNTestHandler* handler) {
+    pthread_mutex_lock(&handler->lock);
+    while (!handler->done)
+        pthread_cond_wait(&handler->invoked, &handler->lock);
+    pthread_mutex_unlock(&handler->lock);
+}
+
+static void FXNTestCreateResource (char* path, uint8_t* data, size_t size) {
+    const int fd = mkstemp(path);
+    FXN_CHECK(fd >= 0);
+    for (size_t i = 0; i < size; ++i)
+        data[i] = (uint8_t)(i * 31);
+    FXN_CHECK(write(fd, data, size) == (ssize_t)size);
+    close(fd);
+}
+
+static void TestCreateLoadsResources (void) {
+    char paths[2][32] = { "/tmp/fxn-resource-XXXXXX", "/tmp/fxn-resource-XXXXXX" };
+    uint8_t data[2][4096];
+    FXNConfiguration* configuration = NULL;
+    FXN_CHECK(FXNConfigurationCreate(&configuration) == FXN_OK);
+    FXN_CHECK(FXNConfigurationSetTag(configuration, "@mock/matmul?size=4") == FXN_OK);
+    for (int32_t i = 0; i < 2; ++i) {
+        FXNTestCreateResource(paths[i], data[i], sizeof(data[i]) - (size_t)i * 1024);
+        FXN_CHECK(FXNConfigurationAddResource(configuration, "bin", paths[i]) == FXN_OK);
+    }
+    FXNPredictor* predictor = NULL;
+    FXN_CHECK(FXNPredictorCreate(configuration, &predictor) == FXN_OK);
+    FXN_CHECK(FXNConfigurationRelease(configuration) == FXN_OK);
+    // Resources stay mapped after the files are removed
+    for (int32_t i = 0; i < 2; ++i)
+        unlink(paths[i]);
+    FXN_CHECK(predictor->model->resourceCount == 2);
+    for (int32_t i = 0; i < 2; ++i) {
+        const struct FXNMockResource* resource = &predictor->model->resources[i];
+        const size_t size = sizeof(data[i]) - (size_t)i * 1024;
+        FXN_CHECK(resource->size == size);
+        FXN_CHECK(resource->checksum == FXNMockHash(data[i], size, 0));
+    }
+    FXN_CHECK(FXNPredictorRelease(predictor) == FXN_OK);
+}
+
+static void TestCreateAsyncLoadsResources (void) {
+    char path[] = "/tmp/fxn-resource-XXXXXX";
+    uint8_t data[8192];
+    FXNTestCreateResource(path, data, sizeof(data));
+    FXNConfiguration* configuration = NULL;
+    FXN_CHECK(FXNConfigurationCreate(&configuration) == FXN_OK);
+    FXN_CHECK(FXNConfigurationSetTag(configuration, "@mock/matmul?size=4") == FXN_OK);
+    FXN_CHECK(FXNConfigurationAddResource(configuration, "bin", path) == FXN_OK);
+    struct FXNTestHandler handler = { .lock = PTHREAD_MUTEX_INITIALIZER, .invoked = PTHREAD_COND_INITIALIZER };
+    FXN_CHECK(FXNPredictorCreateAsync(configuration, FXNTestHandlerInvoke, &handler) == FXN_OK);
+    FXN_CHECK(FXNConfigurationRelease(configuration) == FXN_OK);
+    FXNTestHandlerWait(&handler);
+    unlink(path);
+    FXN_CHECK(handler.status == FXN_OK);
+    FXN_CHECK(handler.predictor != NULL);
+    FXN_CHECK(handler.predictor->model->weights != NULL);
+    FXN_CHECK(handler.predictor->model->resources[0].checksum == FXNMockHash(data, sizeof(data), 0));
+    FXN_CHECK(FXNPredictorRelease(handler.predictor) == FXN_OK);
+}
+
+static void TestCreateAsyncMissingResource (void) {
+    FXNConfiguration* configuration = NULL;
+    FXN_CHECK(FXNConfigurationCreate(&configuration) == FXN_OK);
+    FXN_CHECK(FXNConfigurationSetTag(configuration, "@mock/matmul?size=4") == FXN_OK);
+    FXN_CHECK(FXNConfigurationAddResource(configuration, "bin", "/nonexistent/weights.bin") == FXN_OK);
+    struct FXNTestHandler handler = { .lock = PTHREAD_MUTEX_INITIALIZER, .invoked = PTHREAD_COND_INITIALIZER };
+    FXN_CHECK(FXNPredictorCreateAsync(configuration, FXNTestHandlerInvoke, &handler) == FXN_OK);
+    FXN_CHECK(FXNConfigurationRelease(configuration) == FXN_OK);
+    FXNTestHandlerWait(&handler);
+    FXN_CHECK(handler.status == FXN_ERROR_INVALID_ARGUMENT);
+    FXN_CHECK(handler.predictor == NULL);
+}
+
+static void FXNTestReleaseFromHandler (void* context, FXNStatus status, FXNPredictor* predictor) {
+    FXNTestHandlerInvoke(context, predictor ? FXNPredictorRelease(predictor) : status, predictor);
+}
+
+static void TestReleaseWaitsForSwap (void) {
+    char path[] = "/tmp/fxn-resource-XXXXXX";
+    uint8_t data[1 << 16];
+    FXNTestCreateResource(path, data, sizeof(data));
+    FXNPredictor* predictor = FXNTestCreatePredictor("@mock/matmul?size=4", 0, NULL);
+    FXNConfiguration* configuration = NULL;
+    FXN_CHECK(FXNConfigurationCreate(&configuration) == FXN_OK);
+    FXN_CHECK(FXNConfigurationSetTag(configuration, "@mock/matmul?size=8") == FXN_OK);
+    FXN_CHECK(FXNConfigurationAddResource(configuration, "bin", path) == FXN_OK);
+    struct FXNTestHandler handler = { .lock = PTHREAD_MUTEX_INITIALIZER, .invoked = PTHREAD_COND_INITIALIZER };
+    FXN_CHECK(FXNPredictorSwapAsync(predictor, configuration, FXNTestHandlerInvoke, &handler) == FXN_OK);
+    FXN_CHECK(FXNConfigurationRelease(configuration) == FXN_OK);
+    // Releasing the predictor right away waits for the handler instead of freeing the predictor under it
+    FXN_CHECK(FXNPredictorRelease(predictor) == FXN_OK);
+    FXN_CHECK(handler.done);
+    FXN_CHECK(handler.status == FXN_OK);
+    FXN_CHECK(handler.predictor == predictor);
+    unlink(path);
+}
+
+static void TestReleaseFromSwapHandler (void) {
+    FXNPredictor* predictor = FXNTestCreatePredictor("@mock/matmul?size=4", 0, NULL);
+    FXNConfiguration* configuration = NULL;
+    FXN_CHECK(FXNConfigurationCreate(&configuration) == FXN_OK);
+    FXN_CHECK(FXNConfigurationSetTag(configuration, "@mock/matmul?size=8") == FXN_OK);
+    struct FXNTestHandler handler = { .lock = PTHREAD_MUTEX_INITIALIZER, .invoked = PTHREAD_COND_INITIALIZER };
+    FXN_CHECK(FXNPredictorSwapAsync(predictor, configuration, FXNTestReleaseFromHandler, &handler) == FXN_OK);
+    FXN_CHECK(FXNConfigurationRelease(configuration) == FXN_OK);
+    FXNTestHandlerWait(&handler);
+    FXN_CHECK(handler.status == FXN_ERROR_INVALID_OPERATION);
+    FXN_CHECK(FXNPredictorRelease(predictor) == FXN_OK);
+}
+
+int main (void) {
+    TestCreateLoadsResources();
+    TestCreateAsyncLoadsResources();
+    TestCreateAsyncMissingResource();
+    TestReleaseWaitsForSwap();
+    TestReleaseFromSwapHandler();
+    return EXIT_SUCCESS;
+}
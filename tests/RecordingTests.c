@@ -0,0 +1,91 @@
+//
+//  RecordingTests.c
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#include <string.h>
+#include <unistd.h>
+#include "Tests.h"
+
+#define FXN_TEST_PREDICTIONS 4
+
+static void TestRecordAndRead (void) {
+    char path[] = "/tmp/fxn-recording-XXXXXX";
+    const int fd = mkstemp(path);
+    FXN_CHECK(fd >= 0);
+    close(fd);
+    // Record
+    FXNPredictor* predictor = FXNTestCreatePredictor("@mock/matmul?size=4", 0, path);
+    for (int32_t i = 0; i < FXN_TEST_PREDICTIONS; ++i) {
+        FXNValueMap* inputs = FXNTestCreateMatmulInputs(4, (float)i);
+        FXNPrediction* prediction = NULL;
+        FXN_CHECK(FXNPredictorCreatePrediction(predictor, inputs, &prediction) == FXN_OK);
+        FXN_CHECK(FXNPredictionRelease(prediction) == FXN_OK);
+        FXN_CHECK(FXNValueMapRelease(inputs) == FXN_OK);
+    }
+    FXN_CHECK(FXNPredictorRelease(predictor) == FXN_OK);
+    // Read
+    FXNRecording* recording = NULL;
+    int32_t count = 0;
+    double previous = -1.0;
+    FXN_CHECK(FXNRecordingCreate(path, &recording) == FXN_OK);
+    FXN_CHECK(FXNRecordingGetCount(recording, &count) == FXN_OK && count == FXN_TEST_PREDICTIONS);
+    for (int32_t i = 0; i < count; ++i) {
+        FXNValueMap* inputs = NULL;
+        FXNValue* a = NULL;
+        void* data = NULL;
+        double timestamp = 0, latency = 0;
+        int32_t shape[2] = { 0 };
+        FXN_CHECK(FXNRecordingGetPrediction(recording, i, &inputs, &timestamp, &latency) == FXN_OK);
+        FXN_CHECK(timestamp >= previous && latency >= 0);
+        FXN_CHECK(FXNValueMapGetValue(inputs, "a", &a) == FXN_OK);
+        FXN_CHECK(FXNValueGetShape(a, shape, 2) == FXN_OK && shape[0] == 1 && shape[1] == 4);
+        FXN_CHECK(FXNValueGetData(a, &data) == FXN_OK && ((float*)data)[3] == (float)i);
+        previous = timestamp;
+    }
+    FXNValueMap* inputs = NULL;
+    double timestamp = 0, latency = 0;
+    FXN_CHECK(FXNRecordingGetPrediction(recording, count, &inputs, &timestamp, &latency) == FXN_ERROR_INVALID_ARGUMENT);
+    FXN_CHECK(FXNRecordingRelease(recording) == FXN_OK);
+    // Truncated recordings are rejected
+    FXN_CHECK(truncate(path, 12) == 0);
+    FXN_CHECK(FXNRecordingCreate(path, &recording) == FXN_ERROR_INVALID_ARGUMENT);
+    unlink(path);
+}
+
+static void TestInvalidRecording (void) {
+    char path[] = "/tmp/fxn-recording-XXXXXX";
+    const int fd = mkstemp(path);
+    FXN_CHECK(fd >= 0);
+    FXN_CHECK(write(fd, "not a recording", 15) == 15);
+    close(fd);
+    FXNRecording* recording = NULL;
+    FXN_CHECK(FXNRecordingCreate(path, &recording) == FXN_ERROR_INVALID_ARGUMENT);
+    FXN_CHECK(FXNRecordingCreate("/nonexistent/recording.fxnrec", &recording) == FXN_ERROR_INVALID_ARGUMENT);
+    unlink(path);
+}
+
+static void TestRecordingWriteFailure (void) {
+    // Writes to `/dev/full` fail, which stops recording without failing predictions
+    if (access("/dev/full", W_OK) != 0)
+        return;
+    FXNPredictor* predictor = FXNTestCreatePredictor("@mock/matmul?size=4", 0, "/dev/full");
+    FXNValueMap* inputs = FXNTestCreateMatmulInputs(4, 1.0f);
+    for (int32_t i = 0; i < 2; ++i) {
+        FXNPrediction* prediction = NULL;
+        FXN_CHECK(FXNPredictorCreatePrediction(predictor, inputs, &prediction) == FXN_OK);
+        FXN_CHECK(FXNPredictionRelease(prediction) == FXN_OK);
+    }
+    FXN_CHECK(FXNValueMapRelease(inputs) == FXN_OK);
+    FXN_CHECK(FXNPredictorRelease(predictor) == FXN_OK);
+}
+
+int main (void) {
+    TestRecordAndRead();
+    TestInvalidRecording();
+    TestRecordingWriteFailure();
+    return EXIT_SUCCESS;
+}
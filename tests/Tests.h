@@ -0,0 +1,56 @@
+//
+//  Tests.h
+//  Function
+//
+//  Created by Yusuf Olokoba on 10/19/2026.
+//  Copyright © 2025 NatML Inc. All rights reserved.
+//
+
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <Function/Function.h>
+
+/*!
+ @abstract Abort the test with the failing condition when `condition` is false.
+*/
+#define FXN_CHECK(condition) do {                                                       \
+    if (!(condition)) {                                                                 \
+        fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);   \
+        exit(EXIT_FAILURE);                                                             \
+    }                                                                                   \
+} while (0)
+
+/*!
+ @abstract Create a predictor for a mock predictor tag.
+*/
+static inline FXNPredictor* FXNTestCreatePredictor (const char* tag, int64_t cacheCapacity, const char* recordingPath) {
+    FXNConfiguration* configuration = NULL;
+    FXNPredictor* predictor = NULL;
+    FXN_CHECK(FXNConfigurationCreate(&configuration) == FXN_OK);
+    FXN_CHECK(FXNConfigurationSetTag(configuration, tag) == FXN_OK);
+    FXN_CHECK(FXNConfigurationSetResultCacheCapacity(configuration, cacheCapacity) == FXN_OK);
+    if (recordingPath)
+        FXN_CHECK(FXNConfigurationSetRecordingPath(configuration, recordingPath) == FXN_OK);
+    FXN_CHECK(FXNPredictorCreate(configuration, &predictor) == FXN_OK);
+    FXN_CHECK(FXNConfigurationRelease(configuration) == FXN_OK);
+    return predictor;
+}
+
+/*!
+ @abstract Create inputs for a `@mock/matmul` predictor with a single row filled with `value`.
+*/
+static inline FXNValueMap* FXNTestCreateMatmulInputs (int32_t size, float value) {
+    FXNValueMap* inputs = NULL;
+    FXNValue* a = NULL;
+    const int32_t shape[] = { 1, size };
+    FXN_CHECK(FXNValueMapCreate(&inputs) == FXN_OK);
+    FXN_CHECK(FXNValueCreateArray(NULL, shape, 2, FXN_DTYPE_FLOAT32, FXN_VALUE_FLAG_NONE, &a) == FXN_OK);
+    float* data = NULL;
+    FXN_CHECK(FXNValueGetData(a, (void**)&data) == FXN_OK);
+    for (int32_t i = 0; i < size; ++i)
+        data[i] = value;
+    FXN_CHECK(FXNValueMapSetValue(inputs, "a", a) == FXN_OK);
+    return inputs;
+}